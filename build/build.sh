@@ -53,6 +53,7 @@ usage()
     echo "[-opt]                      Build optimized library only (default)"
     echo "[-edge]                     Build edge of x64.  Turns off opt and dbg"
     echo "[-hip]                      Enable hip bindings"
+    echo "[-bench]                    Enable building of host side micro benchmarks"
     echo "[-disable-werror]           Disable compilation with warnings as error"
     echo "[-nocmake]                  Skip CMake call"
     echo "[-noert]                    Do not treat missing ERT FW as a build error"
@@ -156,6 +157,10 @@ while [ $# -gt 0 ]; do
             shift
             cmake_flags+=" -DXRT_ENABLE_HIP=ON"
             ;;
+        -bench)
+            shift
+            cmake_flags+=" -DXRT_ENABLE_BENCH=ON"
+            ;;
         -base)
             shift
             base_build=1
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef xrt_core_bench_bench_h_
+#define xrt_core_bench_bench_h_
+
+// Minimal header only benchmark harness used by the XRT micro
+// benchmarks.  Reporting mimics Google Benchmark such that results
+// can be compared with familiar tooling, but there is no dependency
+// on an external library.
+//
+// A benchmark is a function taking a bench::state.  The function
+// runs state.iterations() iterations of the operation being measured
+// and may add user counters that are reported along with the time.
+//
+//  static void
+//  bm_foo(xrt_core::bench::state& st)
+//  {
+//    for (uint64_t i = 0; i < st.iterations(); ++i)
+//      foo(st.arg(0));
+//  }
+//
+//  int main(int argc, char* argv[])
+//  {
+//    xrt_core::bench::registry reg;
+//    reg.add("foo", bm_foo, 100000, {1, 4, 16});
+//    return reg.run(argc, argv);
+//  }
+//
+// Command line options accepted by registry::run()
+//  --filter=<str>  run only benchmarks whose name contains <str>
+//  --scale=<f>     scale iteration count of all benchmarks by <f>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace xrt_core::bench {
+
+class state
+{
+  uint64_t m_iterations;
+  std::vector<int64_t> m_args;
+  std::map<std::string, double> m_counters;
+  uint64_t m_pause_ns = 0;
+  std::chrono::steady_clock::time_point m_pause_start;
+
+public:
+  state(uint64_t iterations, std::vector<int64_t> args)
+    : m_iterations(iterations), m_args(std::move(args))
+  {}
+
+  uint64_t
+  iterations() const
+  {
+    return m_iterations;
+  }
+
+  int64_t
+  arg(size_t idx) const
+  {
+    return m_args.at(idx);
+  }
+
+  const std::vector<int64_t>&
+  args() const
+  {
+    return m_args;
+  }
+
+  // Add or overwrite a user counter reported with the benchmark
+  double&
+  counter(const std::string& name)
+  {
+    return m_counters[name];
+  }
+
+  const std::map<std::string, double>&
+  counters() const
+  {
+    return m_counters;
+  }
+
+  // Exclude setup work from the measured time
+  void
+  pause_timing()
+  {
+    m_pause_start = std::chrono::steady_clock::now();
+  }
+
+  void
+  resume_timing()
+  {
+    auto now = std::chrono::steady_clock::now();
+    m_pause_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_pause_start).count();
+  }
+
+  uint64_t
+  paused_ns() const
+  {
+    return m_pause_ns;
+  }
+};
+
+class registry
+{
+  struct entry
+  {
+    std::string name;
+    std::function<void(state&)> fcn;
+    uint64_t iterations;
+    std::vector<int64_t> args;
+  };
+
+  std::vector<entry> m_entries;
+
+  static std::string
+  arg_name(const std::string& name, const std::vector<int64_t>& args)
+  {
+    std::string nm = name;
+    for (auto arg : args)
+      nm.append("/").append(std::to_string(arg));
+    return nm;
+  }
+
+  static void
+  header()
+  {
+    std::printf("%-48s %15s %15s %12s\n", "Benchmark", "Time", "CPU", "Iterations");
+    std::printf("%s\n", std::string(93, '-').c_str());
+  }
+
+  static void
+  report(const std::string& name, double wall_ns, double cpu_ns, uint64_t iterations,
+         const std::map<std::string, double>& counters)
+  {
+    std::printf("%-48s %12.1f ns %12.1f ns %12llu", name.c_str(),
+                wall_ns / iterations, cpu_ns / iterations,
+                static_cast<unsigned long long>(iterations));
+    for (const auto& [cname, value] : counters)
+      std::printf(" %s=%g", cname.c_str(), value);
+    std::printf("\n");
+    std::fflush(stdout);
+  }
+
+public:
+  // Register benchmark 'fcn' with 'iterations' iterations.  If
+  // 'args' are specified, the benchmark is run once per argument
+  // which is available through state::arg(0).
+  void
+  add(const std::string& name, std::function<void(state&)> fcn,
+      uint64_t iterations, const std::vector<int64_t>& args = {})
+  {
+    if (args.empty()) {
+      m_entries.push_back({name, std::move(fcn), iterations, {}});
+      return;
+    }
+
+    for (auto arg : args)
+      m_entries.push_back({name, fcn, iterations, {arg}});
+  }
+
+  int
+  run(int argc, char* argv[])
+  {
+    std::string filter;
+    double scale = 1.0;
+    for (int i = 1; i < argc; ++i) {
+      std::string opt = argv[i];
+      if (opt.rfind("--filter=", 0) == 0)
+        filter = opt.substr(9);
+      else if (opt.rfind("--scale=", 0) == 0)
+        scale = std::stod(opt.substr(8));
+      else {
+        std::cerr << "usage: " << argv[0] << " [--filter=<str>] [--scale=<f>]\n";
+        return 1;
+      }
+    }
+
+    header();
+    for (const auto& e : m_entries) {
+      auto name = arg_name(e.name, e.args);
+      if (!filter.empty() && name.find(filter) == std::string::npos)
+        continue;
+
+      auto iterations = std::max<uint64_t>(1, static_cast<uint64_t>(e.iterations * scale));
+      state st(iterations, e.args);
+      auto cpu_start = std::clock();
+      auto start = std::chrono::steady_clock::now();
+      e.fcn(st);
+      auto end = std::chrono::steady_clock::now();
+      auto cpu_end = std::clock();
+
+      auto wall_ns = static_cast<double>
+        (std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() - st.paused_ns());
+      auto cpu_ns = 1e9 * (cpu_end - cpu_start) / CLOCKS_PER_SEC;
+      report(name, wall_ns, cpu_ns, iterations, st.counters());
+    }
+    return 0;
+  }
+};
+
+} // xrt_core::bench
+
+#endif
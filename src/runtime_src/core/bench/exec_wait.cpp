@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Measure waiting for command completion through the legacy kds
+// hw_queue on the noop shim.  Each waiting thread repeatedly submits
+// its own command and waits for it to complete.  The benchmark
+// argument is the number of waiting threads.
+//
+// Reported counters are the p50 and p99 wait latency in microseconds
+// and the number of voluntary context switches per completion, which
+// approximates the number of thread wakeups per completion.
+//
+// The kds wait mode is selected at startup, run with --dispatch to
+// use completion dispatch (Runtime.exec_wait_dispatch) and without
+// to use the default broadcast wakeup.
+//
+//  % bench_exec_wait
+//  % bench_exec_wait --dispatch
+#include "bench.h"
+#include "noop.h"
+
+#include "core/common/api/hw_queue.h"
+#include "core/common/hdr_histogram.h"
+#include "core/common/system.h"
+#include "core/common/time.h"
+
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+
+namespace {
+
+constexpr unsigned int completion_delay_us = 5;
+
+using exec_command = xrt_core::bench::noop::exec_command;
+
+uint64_t
+voluntary_context_switches()
+{
+  rusage usage {};
+  getrusage(RUSAGE_SELF, &usage);
+  return static_cast<uint64_t>(usage.ru_nvcsw);
+}
+
+static void
+bm_exec_wait(xrt_core::bench::state& st)
+{
+  auto threads = static_cast<unsigned int>(st.arg(0));
+  auto per_thread = std::max<uint64_t>(1, st.iterations() / threads);
+
+  auto device = xrt_core::get_userpf_device(xrt_core::device::id_type{0});
+  xrt_core::hw_queue queue(device.get());
+
+  std::vector<std::unique_ptr<exec_command>> cmds;
+  for (unsigned int t = 0; t < threads; ++t)
+    cmds.push_back(std::make_unique<exec_command>(device));
+  std::vector<xrt_core::hdr_histogram> latency(threads);
+
+  auto csw_start = voluntary_context_switches();
+
+  std::vector<std::thread> workers;
+  for (unsigned int t = 0; t < threads; ++t)
+    workers.emplace_back([&queue, cmd = cmds[t].get(), &hist = latency[t], per_thread] {
+      for (uint64_t i = 0; i < per_thread; ++i) {
+        cmd->reset();
+        auto start = xrt_core::time_ns();
+        queue.unmanaged_start(cmd);
+        queue.wait(cmd);
+        hist.record(xrt_core::time_ns() - start);
+      }
+    });
+
+  for (auto& w : workers)
+    w.join();
+
+  auto csw = voluntary_context_switches() - csw_start;
+
+  xrt_core::hdr_histogram total;
+  for (auto& hist : latency)
+    total.add(hist);
+
+  st.counter("threads") = threads;
+  st.counter("p50_us") = static_cast<double>(total.percentile(50.0)) / 1000.0;
+  st.counter("p99_us") = static_cast<double>(total.percentile(99.0)) / 1000.0;
+  st.counter("wakeups_per_completion") = static_cast<double>(csw) / static_cast<double>(total.count());
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  // Strip --dispatch before passing remaining options to the registry
+  std::vector<char*> args {argv[0]};
+  bool dispatch = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--dispatch") == 0)
+      dispatch = true;
+    else
+      args.push_back(argv[i]);
+  }
+
+  // Run on the noop shim with asynchronous command completion
+  xrt_core::bench::noop::init(completion_delay_us);
+  xrt::ini::set("Runtime.exec_wait_dispatch", dispatch ? "true" : "false");
+
+  xrt_core::bench::registry reg;
+  const std::vector<int64_t> threads {1, 4, 16, 64};
+  constexpr uint64_t iterations = 1 << 16;
+  reg.add(dispatch ? "exec_wait/dispatch" : "exec_wait/broadcast", bm_exec_wait, iterations, threads);
+  return reg.run(static_cast<int>(args.size()), args.data());
+}
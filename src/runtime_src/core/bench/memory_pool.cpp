@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Stress the range allocator used by the HIP memory pool with a
+// randomized alloc/free workload and compare it with a first-fit free
+// list as previously used by hip::memory_pool_node.  The benchmark
+// argument is the maximum number of live blocks.  Sizes are log
+// uniform between one page and 16MB, so the workload mixes small and
+// large blocks.  Reported counters are the alloc/free rate, the
+// fraction of failed allocations, and the average external
+// fragmentation (1 - largest free block / total free).
+#include "bench.h"
+#include "hip/core/tlsf.h"
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr size_t page_size = 4096;
+constexpr size_t pool_size = static_cast<size_t>(1) << 30;
+constexpr size_t max_block = 16 * 1024 * 1024;
+constexpr size_t npos = xrt::core::hip::tlsf_allocator::npos;
+
+// First-fit allocator over an address ordered free list
+class first_fit_allocator
+{
+  struct slot
+  {
+    size_t start;
+    size_t size;
+  };
+
+  std::list<slot> m_free;
+  std::list<slot> m_alloc;
+
+public:
+  first_fit_allocator(size_t capacity, size_t)
+  {
+    m_free.push_back({0, capacity});
+  }
+
+  size_t
+  allocate(size_t size)
+  {
+    for (auto itr = m_free.begin(); itr != m_free.end(); ++itr) {
+      if (itr->size < size)
+        continue;
+      auto start = itr->start;
+      itr->start += size;
+      itr->size -= size;
+      if (!itr->size)
+        m_free.erase(itr);
+      m_alloc.push_back({start, size});
+      return start;
+    }
+    return npos;
+  }
+
+  size_t
+  deallocate(size_t start)
+  {
+    auto itr = std::find_if(m_alloc.begin(), m_alloc.end(), [start](auto& s) { return s.start == start; });
+    if (itr == m_alloc.end())
+      return 0;
+    auto blk = *itr;
+    m_alloc.erase(itr);
+
+    auto next = std::find_if(m_free.begin(), m_free.end(), [&blk](auto& s) { return s.start > blk.start; });
+    auto pos = m_free.insert(next, blk);
+    if (next != m_free.end() && pos->start + pos->size == next->start) {
+      pos->size += next->size;
+      m_free.erase(next);
+    }
+    if (pos != m_free.begin()) {
+      auto prev = std::prev(pos);
+      if (prev->start + prev->size == pos->start) {
+        prev->size += pos->size;
+        m_free.erase(pos);
+      }
+    }
+    return blk.size;
+  }
+
+  double
+  fragmentation() const
+  {
+    size_t total = 0, largest = 0;
+    for (auto& s : m_free) {
+      total += s.size;
+      largest = std::max(largest, s.size);
+    }
+    return total ? 1.0 - static_cast<double>(largest) / static_cast<double>(total) : 0.0;
+  }
+};
+
+template <typename Allocator>
+static void
+bm_alloc_free(xrt_core::bench::state& st)
+{
+  auto max_live = static_cast<size_t>(st.arg(0));
+
+  st.pause_timing();
+  Allocator alloc(pool_size, page_size);
+  std::mt19937_64 rng(42);
+  std::uniform_real_distribution<double> log_size(std::log2(page_size), std::log2(max_block));
+
+  // Pre-generate the workload so the generator is not timed
+  std::vector<size_t> sizes(st.iterations());
+  for (auto& sz : sizes)
+    sz = static_cast<size_t>(std::exp2(log_size(rng))) & ~(page_size - 1);
+  std::vector<uint64_t> picks(st.iterations());
+  for (auto& p : picks)
+    p = rng();
+
+  std::vector<size_t> live;
+  live.reserve(max_live);
+  uint64_t failed = 0, allocs = 0, samples = 0;
+  double frag = 0.0;
+  st.resume_timing();
+
+  for (uint64_t i = 0; i < st.iterations(); ++i) {
+    bool do_alloc = live.empty() || (live.size() < max_live && (picks[i] & 3));
+    if (do_alloc) {
+      ++allocs;
+      auto offset = alloc.allocate(sizes[i]);
+      if (offset == npos)
+        ++failed;
+      else
+        live.push_back(offset);
+    }
+    else {
+      auto idx = (picks[i] >> 2) % live.size();
+      alloc.deallocate(live[idx]);
+      live[idx] = live.back();
+      live.pop_back();
+    }
+
+    if ((i & 1023) == 0) {
+      st.pause_timing();
+      frag += alloc.fragmentation();
+      ++samples;
+      st.resume_timing();
+    }
+  }
+
+  st.counter("max_live") = static_cast<double>(max_live);
+  st.counter("failed_pct") = allocs ? 100.0 * failed / allocs : 0.0;
+  st.counter("fragmentation") = samples ? frag / samples : 0.0;
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  xrt_core::bench::registry reg;
+  const std::vector<int64_t> live {64, 256, 1024};
+  constexpr uint64_t iterations = 1 << 18;
+  reg.add("first_fit", bm_alloc_free<first_fit_allocator>, iterations, live);
+  reg.add("tlsf", bm_alloc_free<xrt::core::hip::tlsf_allocator>, iterations, live);
+  return reg.run(argc, argv);
+}
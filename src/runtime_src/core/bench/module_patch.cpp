@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Measure the cost of re-patching control code with kernel arguments
+// in the ELF flow.
+//
+//  module/patch_bo     xrt::run::set_arg() of all global arguments,
+//                      alternating between two buffers per argument
+//  module/patch_start  patch_bo followed by start() and wait(), which
+//                      includes the sync of the patched control code
+//
+// Setting a buffer argument of a run created from an ELF patches the
+// buffer address into the control code at every patch site of the
+// argument.  Alternating buffers ensures that each set_arg() patches.
+//
+// The benchmarks require a device that supports the ELF flow, and an
+// ELF with the named kernel.  They are skipped otherwise.
+//
+//  % bench_module_patch --elf=design.elf --kernel=DPU
+#include "bench.h"
+
+#include "core/common/api/module_int.h"
+
+#include "xrt/xrt_bo.h"
+#include "xrt/xrt_device.h"
+#include "xrt/xrt_hw_context.h"
+#include "xrt/xrt_kernel.h"
+#include "xrt/experimental/xrt_elf.h"
+#include "xrt/experimental/xrt_ext.h"
+#include "xrt/experimental/xrt_module.h"
+
+#include <array>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+// ELF and kernel under test, specified on the command line
+std::string s_elf;
+std::string s_kernel;
+
+struct elf_context
+{
+  xrt::device device;
+  xrt::elf elf;
+  xrt::hw_context hwctx;
+  xrt::kernel kernel;
+  xrt::run run;
+
+  // Two buffers for each global argument, indexed by argument index
+  std::vector<std::array<xrt::bo, 2>> bos;
+
+  elf_context()
+    : device(0)
+    , elf(s_elf)
+    , hwctx(device, elf)
+    , kernel(xrt::ext::kernel{hwctx, s_kernel})
+    , run(kernel)
+  {
+    xrt::module mod{elf};
+    for (const auto& info : xrt_core::module_int::get_kernels_info(mod)) {
+      if (info.props.name != s_kernel)
+        continue;
+
+      for (const auto& arg : info.args) {
+        if (arg.type != xrt_core::xclbin::kernel_argument::argtype::global)
+          continue;
+        if (arg.index >= bos.size())
+          bos.resize(arg.index + 1);
+        for (auto& bo : bos[arg.index])
+          bo = xrt::ext::bo{hwctx, 4096};
+      }
+    }
+  }
+
+  size_t
+  set_args(uint64_t iteration)
+  {
+    size_t count = 0;
+    for (size_t idx = 0; idx < bos.size(); ++idx) {
+      if (!bos[idx][0])
+        continue;
+      run.set_arg(static_cast<int>(idx), bos[idx][iteration % 2]);
+      ++count;
+    }
+    return count;
+  }
+};
+
+bool
+have_elf()
+{
+  if (!s_elf.empty() && !s_kernel.empty())
+    return true;
+
+  static bool once = false;
+  if (!once)
+    std::cerr << "skipping module benchmarks, specify --elf=<file> --kernel=<name>\n";
+  once = true;
+  return false;
+}
+
+static void
+bm_module_patch_bo(xrt_core::bench::state& st)
+{
+  if (!have_elf())
+    return;
+
+  st.pause_timing();
+  auto ctx = std::make_unique<elf_context>();
+  st.resume_timing();
+
+  size_t patched = 0;
+  for (uint64_t i = 0; i < st.iterations(); ++i)
+    patched += ctx->set_args(i);
+
+  st.counter("args") = static_cast<double>(patched) / static_cast<double>(st.iterations());
+}
+
+static void
+bm_module_patch_start(xrt_core::bench::state& st)
+{
+  if (!have_elf())
+    return;
+
+  st.pause_timing();
+  auto ctx = std::make_unique<elf_context>();
+  st.resume_timing();
+
+  for (uint64_t i = 0; i < st.iterations(); ++i) {
+    ctx->set_args(i);
+    ctx->run.start();
+    ctx->run.wait();
+  }
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  // Strip --elf and --kernel before passing remaining options to
+  // the registry
+  std::vector<char*> args {argv[0]};
+  for (int i = 1; i < argc; ++i) {
+    std::string opt = argv[i];
+    if (opt.rfind("--elf=", 0) == 0)
+      s_elf = opt.substr(6);
+    else if (opt.rfind("--kernel=", 0) == 0)
+      s_kernel = opt.substr(9);
+    else
+      args.push_back(argv[i]);
+  }
+
+  xrt_core::bench::registry reg;
+  reg.add("module/patch_bo", bm_module_patch_bo, 1 << 16);
+  reg.add("module/patch_start", bm_module_patch_start, 1 << 12);
+  return reg.run(static_cast<int>(args.size()), args.data());
+}
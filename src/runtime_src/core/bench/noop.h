@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef xrt_core_bench_noop_h_
+#define xrt_core_bench_noop_h_
+
+// Helpers for benchmarks that run on the noop shim.  The noop shim
+// emulates BOs, hw contexts and command execution without hardware,
+// it is selected with XCL_EMULATION_MODE=noop before the first device
+// is opened.
+#include "core/common/api/command.h"
+#include "core/common/device.h"
+#include "core/include/xrt/detail/ert.h"
+#include "core/include/xrt/experimental/xrt_ini.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+namespace xrt_core::bench::noop {
+
+// Select the noop shim.  Commands complete after 'delay_us'
+// microseconds, or synchronously upon submission if 0.
+inline void
+init(unsigned int delay_us = 0)
+{
+  setenv("XCL_EMULATION_MODE", "noop", 1); // NOLINT
+  xrt::ini::set("Runtime.noop_completion_delay_us", delay_us);
+}
+
+// Minimal command wrapping an exec BO, not tied to a hw context
+class exec_command : public xrt_core::command
+{
+  std::shared_ptr<xrt_core::device> m_device;
+  std::unique_ptr<xrt_core::buffer_handle> m_bo;
+  ert_packet* m_pkt;
+
+public:
+  explicit exec_command(std::shared_ptr<xrt_core::device> device)
+    : m_device(std::move(device))
+    , m_bo(m_device->alloc_bo(4096, XCL_BO_FLAGS_EXECBUF))
+    , m_pkt(static_cast<ert_packet*>(m_bo->map(xrt_core::buffer_handle::map_type::write)))
+  {
+    std::memset(m_pkt, 0, 4096);
+  }
+
+  ~exec_command() override
+  {
+    m_bo->unmap(m_pkt);
+  }
+
+  exec_command(const exec_command&) = delete;
+  exec_command(exec_command&&) = delete;
+  exec_command& operator=(const exec_command&) = delete;
+  exec_command& operator=(exec_command&&) = delete;
+
+  void
+  reset()
+  {
+    m_pkt->state = ERT_CMD_STATE_NEW;
+  }
+
+  ert_packet*
+  get_ert_packet() const override
+  {
+    return m_pkt;
+  }
+
+  xrt_core::device*
+  get_device() const override
+  {
+    return m_device.get();
+  }
+
+  xrt_core::buffer_handle*
+  get_exec_bo() const override
+  {
+    return m_bo.get();
+  }
+
+  void
+  notify(ert_cmd_state) const override
+  {}
+
+  xrt_core::hwctx_handle*
+  get_hwctx_handle() const override
+  {
+    return nullptr;
+  }
+};
+
+} // xrt_core::bench::noop
+
+#endif
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Measure the host side of clEnqueueReadBufferRect, copying a 2D
+// tile out of a large image buffer, across tile shapes.
+//
+//  rect/row_loop/<shape>   one memcpy per row on the calling thread,
+//                          as previously done by the rect APIs
+//  rect/copy_rect/<shape>  xrt_core::copy_rect()
+//
+// The image buffer is 8192 x 8192 bytes.  The sync_fraction counter
+// is the fraction of the image buffer that is synced for the tile,
+// the rect APIs previously synced the whole buffer.
+//
+//  % bench_rect_copy
+#include "bench.h"
+#include "core/common/strided_copy.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t image_row_pitch = 8192;
+constexpr size_t image_rows = 8192;
+constexpr size_t image_size = image_row_pitch * image_rows;
+
+struct tile_shape
+{
+  const char* name;
+  size_t origin[3];
+  size_t region[3];
+};
+
+const tile_shape shapes[] = {
+  {"64x64",      {128, 128, 0}, {64, 64, 1}},
+  {"256x256",    {128, 128, 0}, {256, 256, 1}},
+  {"1024x1024",  {128, 128, 0}, {1024, 1024, 1}},
+  {"4096x2048",  {128, 128, 0}, {4096, 2048, 1}},
+  {"8192x1024",  {0, 512, 0},   {8192, 1024, 1}},
+};
+
+std::vector<char>&
+image()
+{
+  static std::vector<char> buffer(image_size, 1);
+  return buffer;
+}
+
+void
+row_loop(char* dst, const char* src, const tile_shape& shape)
+{
+  auto src_origin = shape.origin[1] * image_row_pitch + shape.origin[0];
+  for (size_t y = 0; y < shape.region[1]; ++y)
+    std::memcpy(dst + y * shape.region[0], src + src_origin + y * image_row_pitch, shape.region[0]);
+}
+
+void
+copy_rect(char* dst, const char* src, const tile_shape& shape)
+{
+  auto range = xrt_core::rect_byte_range(shape.origin, shape.region, image_row_pitch, image_size);
+  xrt_core::copy_rect(dst, shape.region[0], shape.region[0] * shape.region[1],
+                      src + range.offset, image_row_pitch, image_size, shape.region);
+}
+
+template <void (*copy)(char*, const char*, const tile_shape&)>
+static void
+bm_rect(xrt_core::bench::state& st, const tile_shape& shape)
+{
+  auto bytes = shape.region[0] * shape.region[1];
+
+  st.pause_timing();
+  auto& src = image();
+  std::vector<char> dst(bytes);
+  copy(dst.data(), src.data(), shape);
+  st.resume_timing();
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < st.iterations(); ++i)
+    copy(dst.data(), src.data(), shape);
+  auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  auto range = xrt_core::rect_byte_range(shape.origin, shape.region, image_row_pitch, image_size);
+  st.counter("gb_per_sec") = static_cast<double>(bytes * st.iterations()) / elapsed / 1e9;
+  st.counter("sync_fraction") = static_cast<double>(range.size) / image_size;
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  xrt_core::bench::registry reg;
+  for (const auto& shape : shapes) {
+    // Copy about 1GB per benchmark
+    auto bytes = shape.region[0] * shape.region[1];
+    auto iterations = std::max<uint64_t>(1, (static_cast<uint64_t>(1) << 30) / bytes);
+    reg.add(std::string("rect/row_loop/") + shape.name,
+            [&shape](xrt_core::bench::state& st) { bm_rect<row_loop>(st, shape); }, iterations);
+    reg.add(std::string("rect/copy_rect/") + shape.name,
+            [&shape](xrt_core::bench::state& st) { bm_rect<copy_rect>(st, shape); }, iterations);
+  }
+  return reg.run(argc, argv);
+}
@@ -0,0 +1,367 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Measure the host side cost of the command submission path on the
+// noop shim.  The noop shim completes commands synchronously upon
+// submission, so the measured time is XRT overhead only.
+//
+//  bo/create_destroy/<bytes>      xrt::bo construction and destruction
+//  kernel/construct               xrt::kernel construction
+//  run/set_arg_start_wait         xrt::run set_arg() + start() + wait()
+//  runlist/execute_wait/<runs>    xrt::runlist execute() + wait()
+//  runlist/chain_size/<delay_us>  adaptive chain size of a runlist of 64
+//                                 runs when the application spends
+//                                 <delay_us> between execute() and wait()
+//  rungraph/fork_join/<width>     xrt::rungraph execute() + wait() of a
+//                                 root run, <width> concurrent runs and a
+//                                 join run
+//  hw_queue/start_wait/<threads>  hw_queue throughput, one command per thread
+//  hw_queue/managed_loop/<n>      managed start of n commands one at a time
+//  hw_queue/managed_batch/<n>     managed start of n commands in one batch
+//
+// The noop shim requires an xclbin for kernel objects.  The kernel,
+// run, runlist and rungraph benchmarks are skipped unless an xclbin and the
+// name of a kernel in the xclbin are specified.  Any PL xclbin can
+// be used, no hardware is required.
+//
+//  % bench_submit
+//  % bench_submit --xclbin=vadd.xclbin --kernel=vadd
+#include "bench.h"
+#include "noop.h"
+
+#include "core/common/api/hw_queue.h"
+#include "core/common/api/kernel_int.h"
+#include "core/common/hdr_histogram.h"
+#include "core/common/system.h"
+#include "core/common/time.h"
+
+#include "xrt/xrt_bo.h"
+#include "xrt/xrt_device.h"
+#include "xrt/xrt_hw_context.h"
+#include "xrt/xrt_kernel.h"
+#include "xrt/experimental/xrt_kernel.h"
+#include "xrt/experimental/xrt_xclbin.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using exec_command = xrt_core::bench::noop::exec_command;
+
+// Kernel under test, specified on the command line
+std::string s_xclbin;
+std::string s_kernel;
+
+struct kernel_context
+{
+  xrt::device device;
+  xrt::hw_context hwctx;
+  xrt::kernel kernel;
+
+  // Argument values indexed by argument index, a global argument is
+  // a BO in the memory bank connected to the argument, a scalar
+  // argument is zero initialized bytes of the argument size
+  std::vector<xrt::bo> bos;
+  std::vector<std::vector<char>> scalars;
+
+  kernel_context()
+    : device(0)
+    , hwctx(device, device.register_xclbin(xrt::xclbin{s_xclbin}))
+    , kernel(hwctx, s_kernel)
+  {
+    auto xkernel = hwctx.get_xclbin().get_kernel(s_kernel);
+    for (const auto& arg : xkernel.get_args()) {
+      auto idx = arg.get_index();
+      if (idx >= bos.size()) {
+        bos.resize(idx + 1);
+        scalars.resize(idx + 1);
+      }
+      auto type = arg.get_host_type();
+      if (!type.empty() && type.back() == '*')
+        bos[idx] = xrt::bo(device, 4096, kernel.group_id(static_cast<int>(idx)));
+      else
+        scalars[idx].resize(arg.get_size());
+    }
+  }
+
+  void
+  set_args(xrt::run& run) const
+  {
+    for (size_t idx = 0; idx < bos.size(); ++idx) {
+      if (bos[idx])
+        run.set_arg(static_cast<int>(idx), bos[idx]);
+      else if (!scalars[idx].empty())
+        run.set_arg(static_cast<int>(idx), static_cast<const void*>(scalars[idx].data()), scalars[idx].size());
+    }
+  }
+};
+
+bool
+have_kernel()
+{
+  if (!s_xclbin.empty() && !s_kernel.empty())
+    return true;
+
+  static bool once = false;
+  if (!once)
+    std::cerr << "skipping kernel benchmarks, specify --xclbin=<file> --kernel=<name>\n";
+  once = true;
+  return false;
+}
+
+static void
+bm_bo_create_destroy(xrt_core::bench::state& st)
+{
+  auto bytes = static_cast<size_t>(st.arg(0));
+  xrt::device device{0};
+  for (uint64_t i = 0; i < st.iterations(); ++i)
+    xrt::bo bo{device, bytes, xrt::bo::flags::host_only, 0};
+}
+
+static void
+bm_kernel_construct(xrt_core::bench::state& st)
+{
+  if (!have_kernel())
+    return;
+
+  st.pause_timing();
+  kernel_context ctx;
+  st.resume_timing();
+
+  for (uint64_t i = 0; i < st.iterations(); ++i)
+    xrt::kernel kernel{ctx.hwctx, s_kernel};
+}
+
+static void
+bm_run_set_arg_start_wait(xrt_core::bench::state& st)
+{
+  if (!have_kernel())
+    return;
+
+  st.pause_timing();
+  kernel_context ctx;
+  xrt::run run{ctx.kernel};
+  xrt_core::hdr_histogram latency;
+  st.resume_timing();
+
+  for (uint64_t i = 0; i < st.iterations(); ++i) {
+    auto start = xrt_core::time_ns();
+    ctx.set_args(run);
+    run.start();
+    run.wait();
+    latency.record(xrt_core::time_ns() - start);
+  }
+
+  st.counter("p50_us") = static_cast<double>(latency.percentile(50.0)) / 1000.0;
+  st.counter("p99_us") = static_cast<double>(latency.percentile(99.0)) / 1000.0;
+}
+
+static void
+bm_runlist_execute_wait(xrt_core::bench::state& st)
+{
+  if (!have_kernel())
+    return;
+
+  auto nruns = static_cast<size_t>(st.arg(0));
+
+  st.pause_timing();
+  kernel_context ctx;
+  xrt::runlist runlist{ctx.hwctx};
+  std::vector<xrt::run> runs;
+  for (size_t i = 0; i < nruns; ++i) {
+    auto& run = runs.emplace_back(ctx.kernel);
+    ctx.set_args(run);
+    runlist.add(run);
+  }
+  st.resume_timing();
+
+  auto start = xrt_core::time_ns();
+  for (uint64_t i = 0; i < st.iterations(); ++i) {
+    runlist.execute();
+    runlist.wait();
+  }
+  auto elapsed_ns = xrt_core::time_ns() - start;
+
+  st.counter("runs") = static_cast<double>(nruns);
+  st.counter("ns_per_run") = static_cast<double>(elapsed_ns) / static_cast<double>(st.iterations() * nruns);
+}
+
+// The adaptive chain size follows the latency of the runs, it must
+// not depend on how long the application takes to call wait().  With
+// the noop shim the runs complete upon submission, the chain size
+// stays at its initial value for any delay.  Requires the default
+// Runtime.runlist_chain_size=0.
+static void
+bm_runlist_chain_size(xrt_core::bench::state& st)
+{
+  if (!have_kernel())
+    return;
+
+  constexpr size_t nruns = 64;
+  auto delay = std::chrono::microseconds(st.arg(0));
+
+  st.pause_timing();
+  kernel_context ctx;
+  xrt::runlist runlist{ctx.hwctx};
+  std::vector<xrt::run> runs;
+  for (size_t i = 0; i < nruns; ++i) {
+    auto& run = runs.emplace_back(ctx.kernel);
+    ctx.set_args(run);
+    runlist.add(run);
+  }
+  auto initial = xrt_core::kernel_int::get_chain_size(runlist);
+  st.resume_timing();
+
+  for (uint64_t i = 0; i < st.iterations(); ++i) {
+    runlist.execute();
+    std::this_thread::sleep_for(delay);
+    runlist.wait();
+  }
+
+  st.counter("delay_us") = static_cast<double>(st.arg(0));
+  st.counter("initial_chain") = static_cast<double>(initial);
+  st.counter("chain") = static_cast<double>(xrt_core::kernel_int::get_chain_size(runlist));
+}
+
+static void
+bm_rungraph_fork_join(xrt_core::bench::state& st)
+{
+  if (!have_kernel())
+    return;
+
+  auto width = static_cast<size_t>(st.arg(0));
+
+  st.pause_timing();
+  kernel_context ctx;
+  xrt::rungraph graph{ctx.hwctx};
+  std::vector<xrt::run> runs;
+  runs.reserve(width + 2);
+  for (size_t i = 0; i < width + 2; ++i)
+    ctx.set_args(runs.emplace_back(ctx.kernel));
+
+  auto& root = runs.front();
+  auto& join = runs.back();
+  std::vector<xrt::run> branches(runs.begin() + 1, runs.end() - 1);
+  graph.add(root);
+  for (const auto& run : branches)
+    graph.add(run, {root});
+  graph.add(join, branches);
+  st.resume_timing();
+
+  auto start = xrt_core::time_ns();
+  for (uint64_t i = 0; i < st.iterations(); ++i) {
+    graph.execute();
+    graph.wait();
+  }
+  auto elapsed_ns = xrt_core::time_ns() - start;
+
+  st.counter("runs") = static_cast<double>(runs.size());
+  st.counter("ns_per_run") = static_cast<double>(elapsed_ns) / static_cast<double>(st.iterations() * runs.size());
+}
+
+static void
+bm_hw_queue_start_wait(xrt_core::bench::state& st)
+{
+  auto threads = static_cast<unsigned int>(st.arg(0));
+  auto per_thread = std::max<uint64_t>(1, st.iterations() / threads);
+
+  auto device = xrt_core::get_userpf_device(xrt_core::device::id_type{0});
+  xrt_core::hw_queue queue(device.get());
+
+  std::vector<std::unique_ptr<exec_command>> cmds;
+  for (unsigned int t = 0; t < threads; ++t)
+    cmds.push_back(std::make_unique<exec_command>(device));
+
+  auto start = xrt_core::time_ns();
+  std::vector<std::thread> workers;
+  for (unsigned int t = 0; t < threads; ++t)
+    workers.emplace_back([&queue, cmd = cmds[t].get(), per_thread] {
+      for (uint64_t i = 0; i < per_thread; ++i) {
+        cmd->reset();
+        queue.unmanaged_start(cmd);
+        queue.wait(cmd);
+      }
+    });
+
+  for (auto& w : workers)
+    w.join();
+  auto elapsed_ns = xrt_core::time_ns() - start;
+
+  st.counter("threads") = threads;
+  st.counter("cmds_per_sec") = 1e9 * static_cast<double>(per_thread * threads) / static_cast<double>(elapsed_ns);
+}
+
+template <bool batch>
+static void
+bm_hw_queue_managed(xrt_core::bench::state& st)
+{
+  auto ncmds = static_cast<size_t>(st.arg(0));
+
+  auto device = xrt_core::get_userpf_device(xrt_core::device::id_type{0});
+  xrt_core::hw_queue queue(device.get());
+
+  std::vector<std::unique_ptr<exec_command>> cmds;
+  std::vector<xrt_core::command*> ptrs;
+  for (size_t i = 0; i < ncmds; ++i) {
+    cmds.push_back(std::make_unique<exec_command>(device));
+    ptrs.push_back(cmds.back().get());
+  }
+  xrt_core::span<xrt_core::command*> span{ptrs.data(), ptrs.size()};
+
+  auto iterations = std::max<uint64_t>(1, st.iterations() / ncmds);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    for (auto& cmd : cmds)
+      cmd->reset();
+
+    if (batch) {
+      queue.managed_start(span);
+    }
+    else {
+      for (auto cmd : ptrs)
+        queue.managed_start(cmd);
+    }
+
+    queue.wait(span, std::chrono::milliseconds{0});
+  }
+
+  st.counter("cmds") = static_cast<double>(ncmds);
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  // Strip --xclbin and --kernel before passing remaining options to
+  // the registry
+  std::vector<char*> args {argv[0]};
+  for (int i = 1; i < argc; ++i) {
+    std::string opt = argv[i];
+    if (opt.rfind("--xclbin=", 0) == 0)
+      s_xclbin = opt.substr(9);
+    else if (opt.rfind("--kernel=", 0) == 0)
+      s_kernel = opt.substr(9);
+    else
+      args.push_back(argv[i]);
+  }
+
+  xrt_core::bench::noop::init();
+
+  xrt_core::bench::registry reg;
+  reg.add("bo/create_destroy", bm_bo_create_destroy, 1 << 16, {4096, 1 << 16, 1 << 20});
+  reg.add("kernel/construct", bm_kernel_construct, 1 << 12);
+  reg.add("run/set_arg_start_wait", bm_run_set_arg_start_wait, 1 << 16);
+  reg.add("runlist/execute_wait", bm_runlist_execute_wait, 1 << 12, {1, 8, 64});
+  reg.add("runlist/chain_size", bm_runlist_chain_size, 1 << 6, {0, 100, 1000});
+  reg.add("rungraph/fork_join", bm_rungraph_fork_join, 1 << 12, {1, 8, 64});
+  reg.add("hw_queue/start_wait", bm_hw_queue_start_wait, 1 << 18, {1, 4, 16});
+  reg.add("hw_queue/managed_loop", bm_hw_queue_managed<false>, 1 << 18, {8, 64});
+  reg.add("hw_queue/managed_batch", bm_hw_queue_managed<true>, 1 << 18, {8, 64});
+  return reg.run(static_cast<int>(args.size()), args.data());
+}
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Compare the mutex based xrt_core::task::mpmcqueue with the bounded
+// lock-free variant under increasing producer contention.  Each
+// benchmark argument is the number of producer threads, the number
+// of consumer threads is fixed.
+#include "bench.h"
+#include "core/common/task.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr unsigned int num_consumers = 4;
+
+struct item {};
+
+template <typename Queue>
+static void
+bm_queue(xrt_core::bench::state& st)
+{
+  auto producers = static_cast<unsigned int>(st.arg(0));
+  auto per_producer = st.iterations() / producers;
+  auto total = per_producer * producers;
+
+  Queue queue;
+  item work;
+  std::atomic<uint64_t> consumed {0};
+
+  std::vector<std::thread> consumers;
+  for (unsigned int c = 0; c < num_consumers; ++c)
+    consumers.emplace_back([&queue, &consumed] {
+      while (queue.getWork())
+        consumed.fetch_add(1, std::memory_order_relaxed);
+    });
+
+  std::vector<std::thread> threads;
+  for (unsigned int p = 0; p < producers; ++p)
+    threads.emplace_back([&queue, &work, per_producer] {
+      for (uint64_t i = 0; i < per_producer; ++i)
+        queue.addWork(&work);
+    });
+
+  for (auto& t : threads)
+    t.join();
+
+  while (consumed.load(std::memory_order_relaxed) < total)
+    std::this_thread::yield();
+
+  queue.stop();
+  for (auto& t : consumers)
+    t.join();
+
+  st.counter("producers") = producers;
+  st.counter("consumers") = num_consumers;
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  xrt_core::bench::registry reg;
+  const std::vector<int64_t> producers {1, 4, 16, 64};
+  constexpr uint64_t iterations = 1 << 20;
+  reg.add("mpmcqueue", bm_queue<xrt_core::task::mpmcqueue<item*>>, iterations, producers);
+  reg.add("bounded_mpmcqueue", bm_queue<xrt_core::task::bounded_mpmcqueue<item*>>, iterations, producers);
+  return reg.run(argc, argv);
+}
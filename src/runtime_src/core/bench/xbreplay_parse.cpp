@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Measure xbreplay trace ingestion, the matching of Entry and Exit
+// marker lines of a trace, on a synthetic trace.
+//
+//  xbreplay/parse/<threads>   trace_parser, memory mapped trace
+//                             tokenized and matched by <threads>
+//  xbreplay/parse_regex       per line regex matching as previously
+//                             done by the sequence reconstructor
+//
+// The synthetic trace has 8 application threads each making API
+// calls on their own objects.  The regex baseline is run on a trace
+// 1/16 the size since it is much slower.
+//
+// Each iteration parses the whole trace.
+//
+//  % bench_xbreplay_parse
+#include "bench.h"
+
+#include "trace_parser.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+
+namespace xbr = xrt_core::tools::xbreplay;
+
+constexpr size_t app_threads = 8;
+constexpr size_t default_calls = 1 << 20;
+
+// Synthesize a trace with 'ncalls' calls spread over app threads.
+// Calls of different threads interleave.
+class trace_file
+{
+  std::string m_path;
+  size_t m_lines = 0;
+
+public:
+  explicit trace_file(size_t ncalls)
+    : m_path((std::filesystem::temp_directory_path() /
+              ("bench_xbreplay_parse_" + std::to_string(getpid()) + "_" +
+               std::to_string(ncalls) + ".txt")).string())
+  {
+    static const char* apis[] = {
+      "xrt::run::set_arg(int, const xrt::bo&)(0, 0x55d0c0a3b2c0)",
+      "xrt::run::start()()",
+      "xrt::run::wait(const std::chrono::milliseconds&)(0)",
+      "xrt::bo::sync(xclBOSyncDirection, size_t, size_t)(0, 4096, 0)",
+    };
+    static const char* exits[] = {
+      "xrt::run::set_arg(int, const xrt::bo&)|",
+      "xrt::run::start()|",
+      "xrt::run::wait(const std::chrono::milliseconds&)=4|",
+      "xrt::bo::sync(xclBOSyncDirection, size_t, size_t)|",
+    };
+
+    std::ofstream ostr(m_path);
+    ostr << "|HEADER|pname:\"bench\"|m_pid:1234|xrt_ver:2.20.0|os:linux|time:0|\n";
+    ostr << "|START|0|\n";
+
+    // Each app thread has an open entry, close it before the next
+    // entry of the same thread
+    uint64_t ns = 0;
+    for (size_t call = 0; call < ncalls; ++call) {
+      auto tid = 140000000000000 + (call % app_threads);
+      auto api = (call / app_threads) % std::size(apis);
+      auto handle = 0x55d0c0a00000 + (call % app_threads) * 0x100;
+      ostr << "|ENTRY|0." << ns++ << "|1234|" << tid << "|0x" << std::hex << handle
+           << std::dec << "|" << apis[api] << "|\n";
+      ostr << "|EXIT|0." << ns++ << "|1234|" << tid << "|0x" << std::hex << handle
+           << std::dec << "|" << exits[api] << "|\n";
+    }
+    ostr << "|END|0|\n";
+    m_lines = 2 * ncalls + 3;
+
+    if (!ostr)
+      throw std::runtime_error("failed to write " + m_path);
+  }
+
+  ~trace_file()
+  {
+    std::error_code ec;
+    std::filesystem::remove(m_path, ec);
+  }
+
+  trace_file(const trace_file&) = delete;
+  trace_file(trace_file&&) = delete;
+  trace_file& operator=(const trace_file&) = delete;
+  trace_file& operator=(trace_file&&) = delete;
+
+  const std::string&
+  path() const
+  {
+    return m_path;
+  }
+
+  size_t
+  lines() const
+  {
+    return m_lines;
+  }
+};
+
+static void
+bm_parse(xrt_core::bench::state& st)
+{
+  auto threads = static_cast<unsigned int>(st.arg(0));
+
+  st.pause_timing();
+  trace_file file{default_calls};
+  st.resume_timing();
+
+  size_t calls = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < st.iterations(); ++i) {
+    xbr::mapped_trace trace{file.path()};
+    calls += xbr::trace_parser::parse(trace.view(), threads).size();
+  }
+  auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  st.counter("calls") = static_cast<double>(calls) / static_cast<double>(st.iterations());
+  st.counter("mlines_per_sec") = static_cast<double>(file.lines() * st.iterations()) / elapsed / 1e6;
+}
+
+// Matching as previously done by xbreplay, a fresh regex per
+// attribute per line, scanning forward from each entry for its exit.
+std::string
+find_attribute(const std::string& line, uint8_t offset, const std::string& pattern)
+{
+  std::regex regex(pattern);
+  std::smatch match;
+  if (std::regex_search(line, match, regex))
+    return match[offset].str();
+  return "";
+}
+
+std::tuple<std::string, std::string, std::string>
+get_line_attributes(const std::string& line, const std::string& pattern)
+{
+  auto api = find_attribute(line, 5, pattern);
+  auto pos = api.find(')');
+  return {find_attribute(line, 3, pattern), find_attribute(line, 4, pattern),
+          pos == std::string::npos ? std::string() : api.substr(0, pos + 1)};
+}
+
+static void
+bm_parse_regex(xrt_core::bench::state& st)
+{
+  static const std::string entry_pattern = R"(\|ENTRY\|([\w.]+)\|([\w.]+)\|([\w.]+)\|([\w.]+)\|(.*?)\|)";
+  static const std::string exit_pattern = R"(\|EXIT\|([\w.]+)\|([\w.]+)\|([\w.]+)\|([\w.]+)\|(.*?)\|(.*?)\|)";
+
+  st.pause_timing();
+  trace_file file{default_calls / 16};
+  st.resume_timing();
+
+  size_t calls = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < st.iterations(); ++i) {
+    std::ifstream ifs(file.path());
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(ifs, line);)
+      lines.push_back(std::move(line));
+
+    for (size_t idx = 0; idx < lines.size(); ++idx) {
+      if (lines[idx].find("ENTRY") == std::string::npos)
+        continue;
+      auto entry_id = get_line_attributes(lines[idx], entry_pattern);
+      for (size_t next = idx + 1; next < lines.size(); ++next) {
+        if (lines[next].find("EXIT") != std::string::npos
+            && get_line_attributes(lines[next], exit_pattern) == entry_id) {
+          ++calls;
+          break;
+        }
+      }
+    }
+  }
+  auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  st.counter("calls") = static_cast<double>(calls) / static_cast<double>(st.iterations());
+  st.counter("mlines_per_sec") = static_cast<double>(file.lines() * st.iterations()) / elapsed / 1e6;
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  xrt_core::bench::registry reg;
+  reg.add("xbreplay/parse", bm_parse, 4, {1, 2, 4, 8});
+  reg.add("xbreplay/parse_regex", bm_parse_regex, 1);
+  return reg.run(argc, argv);
+}
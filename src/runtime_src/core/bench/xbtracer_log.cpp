@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Measure the tracing overhead xbtracer adds per traced API call,
+// comparing the text trace with the binary trace (TRACE_FORMAT=bin).
+//
+//  xbtracer/log_text/<threads>  ENTRY and EXIT trace written as text
+//  xbtracer/log_bin/<threads>   ENTRY and EXIT trace written as binary
+//                               records drained by a background thread
+//
+// Each traced call formats its arguments the same way the
+// instrumented XRT APIs do.  The trace format is selected when the
+// logger is constructed, so each benchmark runs in a forked child
+// process with its own trace directory that reports the time per
+// traced call.
+//
+//  % bench_xbtracer_log
+#include "bench.h"
+
+#include "logger.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+namespace xtx = xrt::tools::xbtracer;
+
+// Stand-in for an instrumented XRT object
+struct traced_object
+{
+  std::shared_ptr<int> handle = std::make_shared<int>(0);
+
+  std::shared_ptr<int>
+  get_handle() const
+  {
+    return handle;
+  }
+
+  void
+  call(uint64_t idx)
+  {
+    auto func = "xrt::run::set_arg(int, const xrt::bo&)";
+    XRT_TOOLS_XBT_FUNC_ENTRY(func, static_cast<int>(idx % 8), handle.get());
+    XRT_TOOLS_XBT_FUNC_EXIT(func);
+  }
+};
+
+// Trace 'iterations' calls split over 'threads' threads in a child
+// process and return the average time per call as seen by a thread.
+double
+trace_in_child(bool bin, unsigned int threads, uint64_t iterations)
+{
+  int fds[2];
+  if (pipe(fds) != 0)
+    throw std::runtime_error("pipe failed");
+
+  auto dir = std::filesystem::temp_directory_path() /
+    ("bench_xbtracer_log_" + std::to_string(getpid()) + (bin ? "_bin" : "_text"));
+  std::filesystem::create_directories(dir);
+
+  // The child must not repeat output buffered by the parent
+  std::cout.flush();
+  auto pid = fork();
+  if (pid < 0)
+    throw std::runtime_error("fork failed");
+
+  if (pid == 0) {
+    close(fds[0]);
+    double ns_per_call = -1;
+    try {
+      std::filesystem::current_path(dir);
+      setenv("TRACE_FORMAT", bin ? "bin" : "text", 1);
+      auto now = std::chrono::system_clock::now().time_since_epoch();
+      setenv("START_TIME", std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()).c_str(), 1);
+
+      // Construct the logger outside of the measurement
+      traced_object{}.call(0);
+
+      auto per_thread = std::max<uint64_t>(1, iterations / threads);
+      std::atomic<uint64_t> elapsed {0};
+      std::vector<std::thread> workers;
+      for (unsigned int t = 0; t < threads; ++t)
+        workers.emplace_back([&elapsed, per_thread] {
+          traced_object obj;
+          auto start = std::chrono::steady_clock::now();
+          for (uint64_t i = 0; i < per_thread; ++i)
+            obj.call(i);
+          elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>
+            (std::chrono::steady_clock::now() - start).count();
+        });
+      for (auto& w : workers)
+        w.join();
+
+      ns_per_call = static_cast<double>(elapsed) / static_cast<double>(per_thread * threads);
+    }
+    catch (const std::exception& ex) {
+      std::cerr << "child: " << ex.what() << "\n";
+    }
+    auto written = write(fds[1], &ns_per_call, sizeof(ns_per_call));
+    close(fds[1]);
+    _exit(written == sizeof(ns_per_call) ? 0 : 1);
+  }
+
+  close(fds[1]);
+  double ns_per_call = -1;
+  auto nread = read(fds[0], &ns_per_call, sizeof(ns_per_call));
+  close(fds[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+
+  std::error_code ec;
+  std::filesystem::remove_all(dir, ec);
+
+  if (nread != sizeof(ns_per_call) || ns_per_call < 0)
+    throw std::runtime_error("child failed to trace");
+  return ns_per_call;
+}
+
+template <bool bin>
+static void
+bm_xbtracer_log(xrt_core::bench::state& st)
+{
+  auto threads = static_cast<unsigned int>(st.arg(0));
+  st.counter("threads") = threads;
+  st.counter("ns_per_call") = trace_in_child(bin, threads, st.iterations());
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  xrt_core::bench::registry reg;
+  reg.add("xbtracer/log_text", bm_xbtracer_log<false>, 1 << 18, {1, 4});
+  reg.add("xbtracer/log_bin", bm_xbtracer_log<true>, 1 << 18, {1, 4});
+  return reg.run(argc, argv);
+}
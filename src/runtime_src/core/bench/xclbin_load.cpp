@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Measure the cost of constructing xrt::xclbin from a file, comparing
+// reading the file into memory with memory mapping the file
+// (Runtime.xclbin_mmap).
+//
+//  xclbin/load_read/<mb>   xrt::xclbin from file read into memory
+//  xclbin/load_mmap/<mb>   xrt::xclbin from memory mapped file
+//
+// The xclbin is synthesized with a bitstream section of <mb> MB and
+// a small metadata section.  The file is written before the
+// benchmark runs, so the file is in the page cache for both modes.
+//
+// The configuration is read once per process, so each benchmark runs
+// in a forked child process that reports time per load and the peak
+// resident set size increase of the child.
+//
+//  % bench_xclbin_load
+//  % bench_xclbin_load --filter=/512
+#include "bench.h"
+
+#include "core/include/xrt/detail/xclbin.h"
+#include "core/include/xrt/experimental/xrt_ini.h"
+#include "xrt/experimental/xrt_xclbin.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr size_t mb = 1024 * 1024;
+
+// Synthesize an xclbin with a bitstream section of specified size
+// and an embedded metadata section.  The file is created once per
+// size and removed on exit.
+class xclbin_file
+{
+  std::string m_path;
+
+public:
+  explicit xclbin_file(size_t bitstream_size)
+    : m_path((std::filesystem::temp_directory_path() /
+              ("bench_xclbin_load_" + std::to_string(getpid()) + "_" +
+               std::to_string(bitstream_size / mb) + ".xclbin")).string())
+  {
+    const std::string xml = "<project name=\"bench\"><platform/></project>";
+    constexpr size_t nsections = 2;
+    size_t header_size = sizeof(axlf) + (nsections - 1) * sizeof(axlf_section_header);
+    size_t xml_offset = (header_size + 7) & ~size_t(7);
+    size_t bit_offset = (xml_offset + xml.size() + 7) & ~size_t(7);
+    size_t total = bit_offset + bitstream_size;
+
+    std::vector<char> header(bit_offset, 0);
+    auto top = reinterpret_cast<axlf*>(header.data());
+    std::memcpy(top->m_magic, "xclbin2", 8);
+    top->m_header.m_length = total;
+    top->m_header.m_mode = XCLBIN_FLAT;
+    top->m_header.m_numSections = nsections;
+    top->m_header.uuid[0] = 0xbe;
+
+    auto sec = top->m_sections;
+    sec[0].m_sectionKind = EMBEDDED_METADATA;
+    std::strncpy(sec[0].m_sectionName, "metadata", sizeof(sec[0].m_sectionName) - 1);
+    sec[0].m_sectionOffset = xml_offset;
+    sec[0].m_sectionSize = xml.size();
+    std::memcpy(header.data() + xml_offset, xml.data(), xml.size());
+
+    sec[1].m_sectionKind = BITSTREAM;
+    std::strncpy(sec[1].m_sectionName, "bitstream", sizeof(sec[1].m_sectionName) - 1);
+    sec[1].m_sectionOffset = bit_offset;
+    sec[1].m_sectionSize = bitstream_size;
+
+    std::ofstream ostr(m_path, std::ios::binary);
+    ostr.write(header.data(), static_cast<std::streamsize>(header.size()));
+    std::vector<char> chunk(mb, static_cast<char>(0x5a));
+    for (size_t written = 0; written < bitstream_size; written += chunk.size())
+      ostr.write(chunk.data(), static_cast<std::streamsize>(std::min(chunk.size(), bitstream_size - written)));
+    if (!ostr)
+      throw std::runtime_error("failed to write " + m_path);
+  }
+
+  ~xclbin_file()
+  {
+    std::error_code ec;
+    std::filesystem::remove(m_path, ec);
+  }
+
+  xclbin_file(const xclbin_file&) = delete;
+  xclbin_file(xclbin_file&&) = delete;
+  xclbin_file& operator=(const xclbin_file&) = delete;
+  xclbin_file& operator=(xclbin_file&&) = delete;
+
+  const std::string&
+  path() const
+  {
+    return m_path;
+  }
+};
+
+long
+max_rss_kb()
+{
+  struct rusage usage {};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+struct result
+{
+  double load_ns;
+  double rss_kb;
+};
+
+// Load the xclbin 'iterations' times in a child process with the
+// specified mode and return the averaged load time and the child's
+// peak rss increase.
+result
+load_in_child(const std::string& path, bool mmap, uint64_t iterations)
+{
+  int fds[2];
+  if (pipe(fds) != 0)
+    throw std::runtime_error("pipe failed");
+
+  auto pid = fork();
+  if (pid < 0)
+    throw std::runtime_error("fork failed");
+
+  if (pid == 0) {
+    close(fds[0]);
+    result res {0, 0};
+    try {
+      xrt::ini::set("Runtime.xclbin_mmap", mmap ? "true" : "false");
+      auto rss_start = max_rss_kb();
+      uint64_t elapsed = 0;
+      for (uint64_t i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        xrt::xclbin xclbin{path};
+        elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>
+          (std::chrono::steady_clock::now() - start).count();
+        if (xclbin.get_uuid().to_string().empty())
+          throw std::runtime_error("bad uuid");
+      }
+      res.load_ns = static_cast<double>(elapsed) / static_cast<double>(iterations);
+      res.rss_kb = static_cast<double>(max_rss_kb() - rss_start);
+    }
+    catch (const std::exception& ex) {
+      std::cerr << "child: " << ex.what() << "\n";
+      res.load_ns = -1;
+    }
+    auto written = write(fds[1], &res, sizeof(res));
+    close(fds[1]);
+    _exit(written == sizeof(res) ? 0 : 1);
+  }
+
+  close(fds[1]);
+  result res {-1, 0};
+  auto nread = read(fds[0], &res, sizeof(res));
+  close(fds[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  if (nread != sizeof(res) || res.load_ns < 0)
+    throw std::runtime_error("child failed to load xclbin");
+  return res;
+}
+
+template <bool mmap>
+static void
+bm_xclbin_load(xrt_core::bench::state& st)
+{
+  auto size = static_cast<size_t>(st.arg(0)) * mb;
+
+  st.pause_timing();
+  xclbin_file file{size};
+  st.resume_timing();
+
+  auto res = load_in_child(file.path(), mmap, st.iterations());
+  st.counter("load_ms") = res.load_ns / 1e6;
+  st.counter("peak_rss_mb") = res.rss_kb / 1024.0;
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  xrt_core::bench::registry reg;
+  reg.add("xclbin/load_read", bm_xclbin_load<false>, 8, {64, 256, 512});
+  reg.add("xclbin/load_mmap", bm_xclbin_load<true>, 8, {64, 256, 512});
+  return reg.run(argc, argv);
+}
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Measure the continuous flush of PL trace events to disk against
+// keeping all events in memory until the trace is written.
+//
+//  xdp/pl_events/memory   multimap of all events, as PLDB does
+//                         without a trace memory limit
+//  xdp/pl_events/spill    EventSpill at a 16MB limit, spilled chunks
+//                         merged by EventMerge when read back
+//
+// Events are added with timestamps shuffled within a small window, as
+// trace from the hardware can be, and read back in timestamp order.
+// Each iteration is one event.  The held_events counter is the peak
+// number of events in memory.
+//
+//  % bench_xdp_event_spill
+#include "bench.h"
+
+#include "xdp/profile/database/dynamic_info/event_spill.h"
+#include "xdp/profile/database/events/device_events.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr uint64_t event_bytes = 160;
+constexpr uint64_t limit_bytes = 16 * 1024 * 1024;
+
+xdp::VTFEvent*
+make_event(uint64_t i)
+{
+  // Deterministic shuffle of up to 1024 timestamps
+  auto ts = static_cast<double>(i + ((i * 2654435761u) & 1023));
+  xdp::VTFEvent* event = nullptr;
+  switch (i % 3) {
+  case 0:
+    event = new xdp::KernelEvent(0, ts, xdp::KERNEL, 0, 0, 0);
+    break;
+  case 1:
+    event = new xdp::DeviceMemoryAccess(0, ts, xdp::KERNEL_READ, 0, 1, 0, 0);
+    break;
+  default:
+    event = new xdp::DeviceStreamAccess(0, ts, xdp::KERNEL_STREAM_READ, 0, 2, 0);
+    break;
+  }
+  event->setEventId(i + 1);
+  return event;
+}
+
+template <bool spill>
+static void
+bm_pl_events(xrt_core::bench::state& st)
+{
+  auto start = std::chrono::steady_clock::now();
+
+  xdp::EventSpill spilled(event_bytes, spill ? limit_bytes : 0);
+  std::multimap<double, xdp::VTFEvent*> events;
+  uint64_t held = 0;
+  for (uint64_t i = 0; i < st.iterations(); ++i) {
+    auto event = make_event(i);
+    events.emplace(event->getTimestamp(), event);
+    held = std::max<uint64_t>(held, events.size());
+    if (spilled.enabled() && events.size() >= spilled.threshold()) {
+      std::vector<xdp::VTFEvent*> sorted;
+      sorted.reserve(events.size());
+      for (auto& iter : events)
+        sorted.push_back(iter.second);
+      events.clear();
+      spilled.spill(sorted);
+      for (auto e : sorted)
+        events.emplace_hint(events.end(), e->getTimestamp(), e);
+    }
+  }
+
+  std::vector<xdp::VTFEvent*> remaining;
+  for (auto& iter : events)
+    remaining.push_back(iter.second);
+  events.clear();
+
+  xdp::EventMerge merge(spilled.take(), std::move(remaining));
+  uint64_t count = 0;
+  while (auto event = merge.next())
+    ++count;
+
+  auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  st.counter("ns_per_event") = elapsed / static_cast<double>(count);
+  st.counter("held_events") = static_cast<double>(held);
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  constexpr uint64_t events = 1 << 22;
+
+  xrt_core::bench::registry reg;
+  reg.add("xdp/pl_events/memory", bm_pl_events<false>, events);
+  reg.add("xdp/pl_events/spill", bm_pl_events<true>, events);
+  return reg.run(argc, argv);
+}
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Measure the per event overhead of adding host events to the XDP
+// host event database from concurrent threads, as done by the
+// profiling plugins for each traced XRT API call.
+//
+//  xdp/host_db/sorted/<threads>     HostDB::addSortedEvent (HAL, OpenCL)
+//  xdp/host_db/unsorted/<threads>   HostDB::addUnsortedEvent (native)
+//  xdp/locked_db/sorted/<threads>   multimap insert under a global lock,
+//                                   as previously done by HostDB
+//  xdp/locked_db/unsorted/<threads> vector append under a global lock,
+//                                   as previously done by HostDB
+//
+// Each thread allocates and adds its share of the iterations; the
+// database and its events are deleted outside of the measurement.
+// The ns_per_event counter is the time per event as seen by a thread.
+//
+//  % bench_xdp_host_db
+#include "bench.h"
+
+#include "xdp/profile/database/dynamic_info/host_db.h"
+#include "xdp/profile/database/events/vtf_event.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+class bench_event : public xdp::VTFEvent
+{
+public:
+  explicit bench_event(double ts)
+    : xdp::VTFEvent(0, ts, xdp::NATIVE_API_CALL)
+  {}
+
+  bool
+  isHostEvent() override
+  {
+    return true;
+  }
+};
+
+// Host event database as before per thread arenas
+class locked_db
+{
+  std::multimap<double, xdp::VTFEvent*> m_sorted;
+  std::vector<xdp::VTFEvent*> m_unsorted;
+  std::mutex m_sorted_lock;
+  std::mutex m_unsorted_lock;
+
+public:
+  ~locked_db()
+  {
+    for (auto& [ts, event] : m_sorted)
+      delete event;
+    for (auto event : m_unsorted)
+      delete event;
+  }
+
+  void
+  addSortedEvent(xdp::VTFEvent* event)
+  {
+    std::lock_guard<std::mutex> lock(m_sorted_lock);
+    m_sorted.emplace(event->getTimestamp(), event);
+  }
+
+  void
+  addUnsortedEvent(xdp::VTFEvent* event)
+  {
+    std::lock_guard<std::mutex> lock(m_unsorted_lock);
+    m_unsorted.push_back(event);
+  }
+};
+
+template <typename db_type, bool sorted>
+static void
+bm_add_event(xrt_core::bench::state& st)
+{
+  auto threads = static_cast<unsigned int>(st.arg(0));
+  auto per_thread = std::max<uint64_t>(1, st.iterations() / threads);
+
+  std::atomic<uint64_t> elapsed {0};
+  {
+    db_type db;
+    std::vector<std::thread> workers;
+    for (unsigned int t = 0; t < threads; ++t)
+      workers.emplace_back([&db, &elapsed, per_thread] {
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < per_thread; ++i) {
+          auto ts = static_cast<double>(std::chrono::steady_clock::now().time_since_epoch().count());
+          if constexpr (sorted)
+            db.addSortedEvent(new bench_event(ts));
+          else
+            db.addUnsortedEvent(new bench_event(ts));
+        }
+        elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>
+          (std::chrono::steady_clock::now() - start).count();
+      });
+    for (auto& w : workers)
+      w.join();
+
+    st.pause_timing();
+  }
+  st.resume_timing();
+
+  st.counter("ns_per_event") = static_cast<double>(elapsed) / static_cast<double>(per_thread * threads);
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  const std::vector<int64_t> threads = {1, 2, 4, 8, 16, 32};
+  constexpr uint64_t events = 1 << 20;
+
+  xrt_core::bench::registry reg;
+  reg.add("xdp/host_db/sorted", bm_add_event<xdp::HostDB, true>, events, threads);
+  reg.add("xdp/host_db/unsorted", bm_add_event<xdp::HostDB, false>, events, threads);
+  reg.add("xdp/locked_db/sorted", bm_add_event<locked_db, true>, events, threads);
+  reg.add("xdp/locked_db/unsorted", bm_add_event<locked_db, false>, events, threads);
+  return reg.run(argc, argv);
+}
@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Measure the per call overhead of matching the start and end of a
+// native XRT API call and logging its statistics, from concurrent
+// threads, as done by the native profiling plugin for each traced
+// sync call.
+//
+//  xdp/native_cb/locked/<threads>        event pair, start timestamp and
+//                                        call statistics each matched
+//                                        under a global lock, as
+//                                        previously done by native_cb
+//  xdp/native_cb/thread_local/<threads>  thread local stack of starts and
+//                                        per thread CallStatistics, as
+//                                        done by native_cb
+//
+// Creating the trace events themselves is the same for both and is
+// not included.  The ns_per_call counter is the time per call as seen
+// by a thread.
+//
+//  % bench_xdp_native_cb
+#include "bench.h"
+
+#include "xdp/profile/database/dynamic_info/host_db.h"
+#include "xdp/profile/database/statistics_database.h"
+
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+const char* function_name = "xrt::bo::sync";
+
+uint64_t
+now()
+{
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>
+    (std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Start and end of a call as previously done by native_cb
+class locked_cb
+{
+  xdp::HostDB m_host;
+  xdp::VPStatisticsDatabase m_stats {nullptr};
+  std::mutex m_timestamp_lock;
+  std::map<uint64_t, uint64_t> m_timestamps;
+
+public:
+  void
+  start(uint64_t id)
+  {
+    m_host.registerEventPairStart(id, {id, id});
+    {
+      std::lock_guard<std::mutex> lock(m_timestamp_lock);
+      m_timestamps[id] = now();
+    }
+    m_stats.logFunctionCallStart(function_name, static_cast<double>(now()));
+  }
+
+  uint64_t
+  end(uint64_t id)
+  {
+    auto timestamp = now();
+    m_stats.logFunctionCallEnd(function_name, static_cast<double>(timestamp));
+
+    uint64_t start = 0;
+    {
+      std::lock_guard<std::mutex> lock(m_timestamp_lock);
+      start = m_timestamps[id];
+      m_timestamps.erase(id);
+    }
+    auto events = m_host.matchingEventPairStart(id);
+    return events.APIEventId + (timestamp - start);
+  }
+};
+
+// Start and end of a call as done by native_cb
+class thread_local_cb
+{
+  struct call_start
+  {
+    uint64_t id;
+    uint64_t api_event_id;
+    uint64_t transfer_event_id;
+    uint64_t timestamp;
+  };
+
+  xdp::VPStatisticsDatabase m_stats {nullptr};
+
+  static std::vector<call_start>&
+  starts()
+  {
+    static thread_local std::vector<call_start> s;
+    return s;
+  }
+
+  xdp::CallStatistics*
+  statistics(const char* name)
+  {
+    static thread_local std::unordered_map<const char*, xdp::CallStatistics*> s;
+    static thread_local xdp::VPStatisticsDatabase* owner = nullptr;
+    if (owner != &m_stats) {
+      s.clear();
+      owner = &m_stats;
+    }
+    auto& stats = s[name];
+    if (!stats)
+      stats = m_stats.getCallStatistics(name);
+    return stats;
+  }
+
+public:
+  void
+  start(uint64_t id)
+  {
+    starts().push_back({id, id, id, now()});
+  }
+
+  uint64_t
+  end(uint64_t id)
+  {
+    auto timestamp = now();
+    auto& s = starts();
+    call_start start {id, 0, 0, 0};
+    for (auto iter = s.rbegin(); iter != s.rend(); ++iter) {
+      if (iter->id == id) {
+        start = *iter;
+        s.erase(std::next(iter).base());
+        break;
+      }
+    }
+    statistics(function_name)->update(static_cast<double>(timestamp - start.timestamp));
+    return start.api_event_id + (timestamp - start.timestamp);
+  }
+};
+
+template <typename cb_type>
+static void
+bm_native_call(xrt_core::bench::state& st)
+{
+  auto threads = static_cast<unsigned int>(st.arg(0));
+  auto per_thread = std::max<uint64_t>(1, st.iterations() / threads);
+
+  std::atomic<uint64_t> elapsed {0};
+  std::atomic<uint64_t> sink {0};
+  std::atomic<uint64_t> next_id {1};
+  {
+    cb_type cb;
+    std::vector<std::thread> workers;
+    for (unsigned int t = 0; t < threads; ++t)
+      workers.emplace_back([&cb, &elapsed, &sink, &next_id, per_thread] {
+        uint64_t sum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < per_thread; ++i) {
+          auto id = next_id.fetch_add(1, std::memory_order_relaxed);
+          cb.start(id);
+          sum += cb.end(id);
+        }
+        elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>
+          (std::chrono::steady_clock::now() - start).count();
+        sink += sum;
+      });
+    for (auto& w : workers)
+      w.join();
+
+    st.pause_timing();
+  }
+  st.resume_timing();
+
+  st.counter("ns_per_call") = static_cast<double>(elapsed) / static_cast<double>(per_thread * threads);
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  const std::vector<int64_t> threads = {1, 2, 4, 8, 16, 32};
+  constexpr uint64_t calls = 1 << 20;
+
+  xrt_core::bench::registry reg;
+  reg.add("xdp/native_cb/locked", bm_native_call<locked_cb>, calls, threads);
+  reg.add("xdp/native_cb/thread_local", bm_native_call<thread_local_cb>, calls, threads);
+  return reg.run(argc, argv);
+}
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2021-2022 Xilinx, Inc. All rights reserved.
-// Copyright (C) 2022-2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved.
 #define XRT_CORE_COMMON_SOURCE // in same dll as core_common
 #define XRT_API_SOURCE         // in same dll as API sources
 #include "hw_queue.h"
@@ -10,8 +10,10 @@
 #include "fence_int.h"
 #include "kernel_int.h"
 
+#include "core/common/config_reader.h"
 #include "core/common/debug.h"
 #include "core/common/device.h"
+#include "core/common/span.h"
 #include "core/common/thread.h"
 #include "core/include/xrt/detail/ert.h"
 #include "core/include/xrt_hwqueue.h"
@@ -27,6 +29,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -47,14 +50,14 @@ using command_queue_type = std::vector<xrt_core::command*>;
 static std::exception_ptr s_exception;
 
 inline ert_cmd_state
-get_command_state(xrt_core::command* cmd)
+get_command_state(const xrt_core::command* cmd)
 {
   auto epacket = cmd->get_ert_packet();
   return static_cast<ert_cmd_state>(epacket->state);
 }
 
 inline bool
-completed(xrt_core::command* cmd)
+completed(const xrt_core::command* cmd)
 {
   return (get_command_state(cmd) >= ERT_CMD_STATE_COMPLETED);
 }
@@ -112,6 +115,12 @@ public:
 
     virtual void
     submit(xrt_core::command* cmd) = 0;
+
+    // Submit commands in order.  On return, or if an exception is
+    // thrown, 'submitted' is the number of leading commands that were
+    // submitted for execution.
+    virtual void
+    submit_commands(xrt_core::span<xrt_core::command*> cmds, size_t& submitted) = 0;
   };
 
 private:
@@ -119,6 +128,7 @@ private:
   std::mutex work_mutex;
   std::condition_variable work_cond;
   command_queue_type submitted_cmds;
+  command_queue_type cancelled_cmds;
   bool stop = false;
 
   // thread can be constructed only after data members are initialized
@@ -169,6 +179,18 @@ private:
       // in either running_cmds or submitted_cmds.
       {
         std::lock_guard<std::mutex> lk(work_mutex);
+        // Drop commands that were drained in a previous iteration but
+        // then failed to be submitted by launch().  This is done before
+        // draining so a command that is launched again is kept.
+        if (!cancelled_cmds.empty()) {
+          auto end = std::remove_if(running_cmds.begin(), running_cmds.end(),
+                                    [this](auto cmd) {
+                                      return std::find(cancelled_cmds.begin(), cancelled_cmds.end(), cmd) != cancelled_cmds.end();
+                                    });
+          running_cmds.erase(end, running_cmds.end());
+          cancelled_cmds.clear();
+        }
+
         std::copy(submitted_cmds.begin(), submitted_cmds.end(), std::back_inserter(running_cmds));
         submitted_cmds.clear();
       }
@@ -283,6 +305,51 @@ public:
     // exec_buf call so that actual execution doesn't have to wait.
     work_cond.notify_one();
   }
+
+  // launch() - Submit multiple commands for managed execution
+  //
+  // Same as launching the commands one at a time, but the commands
+  // are tracked under one lock acquisition and the monitor thread is
+  // notified once for all commands.  If submission fails part way,
+  // the commands that were submitted remain tracked and only the
+  // commands that were not submitted are removed.
+  void
+  launch(xrt_core::span<xrt_core::command*> cmds)
+  {
+    if (cmds.empty())
+      return;
+
+    {
+      std::lock_guard<std::mutex> lk(work_mutex);
+      submitted_cmds.insert(submitted_cmds.end(), cmds.begin(), cmds.end());
+    }
+
+    size_t submitted = 0;
+    try {
+      m_impl->submit_commands(cmds, submitted);
+    }
+    catch (...) {
+      // Remove the pending commands that were not submitted.  The
+      // monitor thread may already have drained them to its running
+      // list, in which case they are marked cancelled for the monitor
+      // to drop.  Commands that were submitted remain tracked.
+      {
+        std::lock_guard<std::mutex> lk(work_mutex);
+        for (auto itr = cmds.begin() + submitted; itr != cmds.end(); ++itr) {
+          auto cmd = *itr;
+          auto tracked = std::find(submitted_cmds.begin(), submitted_cmds.end(), cmd);
+          if (tracked != submitted_cmds.end())
+            submitted_cmds.erase(tracked);
+          else
+            cancelled_cmds.push_back(cmd);
+        }
+      }
+      work_cond.notify_one();
+      throw;
+    }
+
+    work_cond.notify_one();
+  }
 };
 
 // Ideally a command manager should be owned by a hw_queue which
@@ -386,6 +453,17 @@ public:
   virtual void
   submit(xrt_core::command* cmd) = 0;  // NOLINT override from base
 
+  // Submit multiple commands for execution in order.  The shim
+  // queue interface has no batched submission, so commands are
+  // submitted one at a time.  'submitted' counts the commands that
+  // were submitted before any failure.
+  void
+  submit_commands(xrt_core::span<xrt_core::command*> cmds, size_t& submitted) override
+  {
+    for (submitted = 0; submitted < cmds.size(); ++submitted)
+      submit(cmds[submitted]);
+  }
+
   // Wait for some command to finish
   virtual std::cv_status
   wait(size_t timeout_ms) = 0;         // NOLINT override from base
@@ -426,6 +504,55 @@ public:
     submit(cmd);
   }
 
+  virtual void
+  managed_start(xrt_core::span<xrt_core::command*> cmds)
+  {
+    get_cmd_manager()->launch(cmds);
+  }
+
+  void
+  unmanaged_start(xrt_core::span<xrt_core::command*> cmds)
+  {
+    size_t submitted = 0;
+    submit_commands(cmds, submitted);
+  }
+
+  // Wait for multiple commands to finish.  The commands are waited
+  // for in order, bit i of 'done' is set when command i has completed
+  // and its completion has been processed.  Waiting stops at the
+  // first command that times out.
+  void
+  wait(xrt_core::span<xrt_core::command*> cmds, size_t timeout_ms, std::vector<bool>& done)
+  {
+    done.assign(cmds.size(), false);
+    auto deadline = std::chrono::steady_clock::now() + timeout_ms * 1ms;
+    for (size_t idx = 0; idx < cmds.size(); ++idx) {
+      size_t remaining = 0;
+      if (timeout_ms) {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>
+          (deadline - std::chrono::steady_clock::now()).count();
+        if (left <= 0)
+          return;
+        remaining = static_cast<size_t>(left);
+      }
+
+      if (wait(cmds[idx], remaining) == std::cv_status::timeout)
+        return;
+
+      done[idx] = true;
+    }
+  }
+
+  // Poll multiple commands, bit i of 'done' is set if command i has
+  // completed
+  void
+  poll(xrt_core::span<xrt_core::command*> cmds, std::vector<bool>& done) const
+  {
+    done.assign(cmds.size(), false);
+    for (size_t idx = 0; idx < cmds.size(); ++idx)
+      done[idx] = poll(cmds[idx]) && completed(cmds[idx]);
+  }
+
 };
 
 // class qds_device - queue implementation for shim queue support
@@ -450,6 +577,12 @@ public:
     throw std::runtime_error("Managed execution is not supported for this device");
   }
 
+  void
+  managed_start(xrt_core::span<xrt_core::command*>) override
+  {
+    throw std::runtime_error("Managed execution is not supported for this device");
+  }
+
   std::cv_status
   wait(size_t /*timeout_ms*/) override
   {
@@ -537,13 +670,151 @@ public:
 //
 // @exec_wait_mutex: Synchronize access to exec_wait
 // @exec_wait_call_count:  Count of number of calls to exec wait
+// @dispatch: Use completion dispatch for command waits
+// @waiters: Threads waiting for specific commands in dispatch mode
 class kds_device : public hw_queue_impl
 {
+  // A thread waiting for a specific command in completion dispatch
+  // mode.  The condition variable is private to the waiter so that
+  // it is woken only when its command completes or when it must
+  // take over the call to device::exec_wait.
+  struct waiter
+  {
+    const xrt_core::command* cmd;
+    std::condition_variable cv;
+    bool done = false;
+
+    explicit waiter(const xrt_core::command* c)
+      : cmd(c)
+    {}
+  };
+
   xrt_core::device* m_device;
   std::mutex m_exec_wait_mutex;
   std::condition_variable m_work;
   uint64_t m_exec_wait_call_count {0};
   uint32_t m_exec_wait_active {0};
+  const bool m_dispatch = xrt_core::config::get_exec_wait_dispatch();
+  std::vector<waiter*> m_waiters;
+
+  // Call device::exec_wait, a timeout of 0 waits until some command
+  // completes.
+  std::cv_status
+  device_exec_wait(size_t timeout_ms)
+  {
+    if (timeout_ms) {
+      // device exec_wait is a system poll which returns
+      // 0 when specified timeout is exceeded without any
+      // file descriptors to read
+      if (m_device->exec_wait(static_cast<int>(timeout_ms)) == 0)
+        // nothing happened within specified time
+        return std::cv_status::timeout;
+      return std::cv_status::no_timeout;
+    }
+
+    // wait for ever for some command to complete
+    constexpr size_t default_timeout = 1000;
+    while (m_device->exec_wait(default_timeout) == 0) {}
+    return std::cv_status::no_timeout;
+  }
+
+  // Resolve which registered commands have completed and wake only
+  // their waiters.  If 'handoff' is true and no thread is calling
+  // device::exec_wait, one remaining waiter is woken to take over.
+  // Caller must hold m_exec_wait_mutex.
+  void
+  dispatch_completions(bool handoff)
+  {
+    auto end = std::remove_if(m_waiters.begin(), m_waiters.end(),
+                              [](waiter* w) {
+                                if (!completed(w->cmd))
+                                  return false;
+                                w->done = true;
+                                w->cv.notify_one();
+                                return true;
+                              });
+    m_waiters.erase(end, m_waiters.end());
+
+    if (handoff && !m_exec_wait_active && !m_waiters.empty())
+      m_waiters.front()->cv.notify_one();
+  }
+
+  void
+  remove_waiter(waiter* w)
+  {
+    auto itr = std::find(m_waiters.begin(), m_waiters.end(), w);
+    if (itr != m_waiters.end())
+      m_waiters.erase(itr);
+  }
+
+  // Completion dispatch wait for a specific command.
+  //
+  // The first thread that finds no other thread in device::exec_wait
+  // becomes the leader and calls device::exec_wait.  Other threads
+  // register a waiter and block on its private condition variable.
+  // When exec_wait returns, the leader wakes the waiters of completed
+  // commands.  The leader keeps calling exec_wait until its own
+  // command completes, then hands over to one remaining waiter.  A
+  // completion therefore wakes its own waiter, plus at most one
+  // waiter when leadership changes, rather than all waiting threads.
+  std::cv_status
+  dispatch_wait(const xrt_core::command* cmd, size_t timeout_ms)
+  {
+    waiter w{cmd};
+    auto deadline = std::chrono::steady_clock::now() + timeout_ms * 1ms;
+    std::unique_lock lk(m_exec_wait_mutex);
+    while (!w.done && !completed(cmd)) {
+      if (!m_exec_wait_active) {
+        // This thread is the leader
+        ++m_exec_wait_active;
+        lk.unlock();
+
+        auto status = std::cv_status::no_timeout;
+        if (timeout_ms) {
+          auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>
+            (deadline - std::chrono::steady_clock::now()).count();
+          status = (remaining > 0)
+            ? device_exec_wait(static_cast<size_t>(remaining))
+            : std::cv_status::timeout;
+        }
+        else {
+          device_exec_wait(0);
+        }
+
+        lk.lock();
+        --m_exec_wait_active;
+        ++m_exec_wait_call_count;
+        bool leave = completed(cmd) || status == std::cv_status::timeout;
+        if (leave)
+          remove_waiter(&w);
+        dispatch_completions(leave);
+        m_work.notify_all();
+
+        if (status == std::cv_status::timeout && !completed(cmd))
+          return std::cv_status::timeout;
+
+        continue;
+      }
+
+      // Some other thread is leader, wait for command completion
+      // or for leadership to be handed over
+      if (std::find(m_waiters.begin(), m_waiters.end(), &w) == m_waiters.end())
+        m_waiters.push_back(&w);
+
+      if (!timeout_ms) {
+        w.cv.wait(lk);
+        continue;
+      }
+
+      if (w.cv.wait_until(lk, deadline) == std::cv_status::timeout && !w.done && !completed(cmd)) {
+        remove_waiter(&w);
+        return std::cv_status::timeout;
+      }
+    }
+
+    remove_waiter(&w);
+    return std::cv_status::no_timeout;
+  }
 
   // Thread safe shim level exec wait call.   This function allows
   // multiple threads to call exec_wait through same device handle.
@@ -627,26 +898,17 @@ class kds_device : public hw_queue_impl
     // this thread will be here because other threads are blocked by
     // the active count that is only modified in the exclusive region.
     // assert(m_exec_wait_active == 1);
-    auto status = std::cv_status::no_timeout;
-    if (timeout_ms) {
-      // device exec_wait is a system poll which returns
-      // 0 when specified timeout is exceeded without any
-      // file descriptors to read
-      if (m_device->exec_wait(static_cast<int>(timeout_ms)) == 0)
-        // nothing happened within specified time
-        status = std::cv_status::timeout;
-    }
-    else {
-      // wait for ever for some command to complete
-      constexpr size_t default_timeout = 1000;
-      while (m_device->exec_wait(default_timeout) == 0) {}
-    }
+    auto status = device_exec_wait(timeout_ms);
 
     // Acquire lock before updating shared state
     {
       std::lock_guard lk(m_exec_wait_mutex);
       thread_exec_wait_call_count = ++m_exec_wait_call_count;
       --m_exec_wait_active;
+
+      // Completions may belong to threads in dispatch_wait
+      if (m_dispatch)
+        dispatch_completions(true);
     }
 
     // Notify any waiting threads so they can check command status and
@@ -671,6 +933,11 @@ public:
   wait(const xrt_core::command* cmd, size_t timeout_ms) override
   {
     volatile auto pkt = cmd->get_ert_packet();
+    if (m_dispatch) {
+      if (dispatch_wait(cmd, timeout_ms) == std::cv_status::timeout)
+        return std::cv_status::timeout;
+    }
+
     while (pkt->state < ERT_CMD_STATE_COMPLETED) {
       // return immediately on timeout
       if (exec_wait(timeout_ms) == std::cv_status::timeout)
@@ -902,6 +1169,38 @@ unmanaged_start(xrt_core::command* cmd)
   get_handle()->unmanaged_start(cmd);
 }
 
+void
+hw_queue::
+managed_start(span<xrt_core::command*> cmds)
+{
+  get_handle()->managed_start(cmds);
+}
+
+void
+hw_queue::
+unmanaged_start(span<xrt_core::command*> cmds)
+{
+  get_handle()->unmanaged_start(cmds);
+}
+
+hw_queue::completion_bitmap
+hw_queue::
+wait(span<xrt_core::command*> cmds, const std::chrono::milliseconds& timeout_ms) const
+{
+  completion_bitmap done;
+  get_handle()->wait(cmds, timeout_ms.count(), done);
+  return done;
+}
+
+hw_queue::completion_bitmap
+hw_queue::
+poll(span<xrt_core::command*> cmds) const
+{
+  completion_bitmap done;
+  get_handle()->poll(cmds, done);
+  return done;
+}
+
 void
 hw_queue::
 submit(xrt_core::buffer_handle* cmd)
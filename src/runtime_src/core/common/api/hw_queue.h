@@ -1,11 +1,13 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved.
 #ifndef XRT_COMMON_API_HW_QUEUE_H
 #define XRT_COMMON_API_HW_QUEUE_H
 
 #include "core/common/config.h"
+#include "core/common/span.h"
 #include "xrt/detail/pimpl.h"
 
+#include <chrono>
 #include <condition_variable>
 #include <vector>
 
@@ -53,6 +55,38 @@ public:
   void
   unmanaged_start(xrt_core::command* cmd);
 
+  // Bitmap of commands from a vectored wait or poll, bit i
+  // corresponds to command i of the span
+  using completion_bitmap = std::vector<bool>;
+
+  // Start multiple commands and manage their execution.  The
+  // commands are registered with the monitor under one lock and the
+  // monitor is woken once for the batch.
+  XRT_CORE_COMMON_EXPORT
+  void
+  managed_start(span<xrt_core::command*> cmds);
+
+  // Start multiple commands with explicit completion control from
+  // application.  The commands are submitted in order.
+  XRT_CORE_COMMON_EXPORT
+  void
+  unmanaged_start(span<xrt_core::command*> cmds);
+
+  // Wait for completion of multiple unmanaged commands.  A timeout of
+  // 0 waits until all commands have completed.  A bit is set in the
+  // returned bitmap for each command that is known to have completed.
+  // Commands without a bit set must be waited for again.
+  XRT_CORE_COMMON_EXPORT
+  completion_bitmap
+  wait(span<xrt_core::command*> cmds, const std::chrono::milliseconds& timeout) const;
+
+  // Poll multiple commands.  A bit is set in the returned bitmap for
+  // each command that has completed.  Completed commands must still
+  // be waited for to process the completion.
+  XRT_CORE_COMMON_EXPORT
+  completion_bitmap
+  poll(span<xrt_core::command*> cmds) const;
+
   // Submit a raw cmd for execution
   void
   submit(xrt_core::buffer_handle* cmd);
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2020 Xilinx, Inc
-// Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved.
 //
 // Xilinx Runtime (XRT) Experimental APIs
 
@@ -9,6 +9,7 @@
 
 // This file defines implementation extensions to the XRT Kernel APIs.
 #include "core/include/xrt/experimental/xrt_kernel.h"
+#include "core/include/xrt/experimental/xrt_module.h"
 #include "core/include/xrt/experimental/xrt_xclbin.h"
 
 #include "core/common/config.h"
@@ -65,6 +66,20 @@ XRT_CORE_COMMON_EXPORT
 const std::bitset<128>&
 get_cumask(const xrt::run& run);
 
+// Get the module holding the patched control code of a run object
+// constructed from an ELF kernel, the module is empty otherwise.
+// Used for testing.
+XRT_CORE_COMMON_EXPORT
+xrt::module
+get_module(const xrt::run& run);
+
+// Get the number of runs per chained command of a runlist.  The
+// chain size of an adaptive runlist changes prior to execute().
+// Used for testing.
+XRT_CORE_COMMON_EXPORT
+size_t
+get_chain_size(const xrt::runlist& runlist);
+
 inline size_t
 get_num_cus(const xrt::run& run)
 {
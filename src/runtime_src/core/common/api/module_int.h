@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2023-2026 Advanced Micro Devices, Inc. All rights reserved.
 //
 // Xilinx Runtime (XRT) Experimental APIs
 
@@ -97,9 +97,18 @@ patch(const xrt::module&, const std::string& argnm, size_t index, const void* va
 // Check that all arguments have been patched and sync the buffer
 // to device if necessary.  Throw if not all arguments have been
 // patched.
+XRT_CORE_COMMON_EXPORT
 void
 sync(const xrt::module&);
 
+// Number of partial syncs of patched control code ranges issued by
+// sync() for runs after the first run.  Patched ranges are merged
+// such that this is at most one sync per run per patched buffer
+// unless patch sites are far apart.  Used for testing.
+XRT_CORE_COMMON_EXPORT
+size_t
+get_patch_sync_count(const xrt::module&);
+
 // Get the ERT command opcode in ELF flow
 ert_cmd_opcode
 get_ert_opcode(const xrt::module& module);
@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Verify that patching the control code of a run object syncs only
+// the patched ranges of the instruction buffer, and that nearby
+// patches are coalesced into a single sync.
+//
+// % patch-sync --elf <file> --kernel <name>
+//
+// The first sync of a module copies the whole instruction buffer.
+// Subsequent syncs copy only the patched ranges, the number of which
+// is reported by module_int::get_patch_sync_count().  Patching one
+// argument three times before a sync touches the same patch sites
+// three times, which must be merged into the same syncs as patching
+// the argument once.
+
+#include "core/common/api/kernel_int.h"
+#include "core/common/api/module_int.h"
+
+#include "xrt/xrt_bo.h"
+#include "xrt/xrt_device.h"
+#include "xrt/xrt_hw_context.h"
+#include "xrt/xrt_kernel.h"
+#include "xrt/experimental/xrt_elf.h"
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t buffer_size = 4096;
+
+void
+usage()
+{
+  std::cout << "usage: patch-sync [options]\n\n";
+  std::cout << "  --elf <file>\n";
+  std::cout << "  --kernel <name>\n";
+  std::cout << "  [--device <index>]\n";
+  std::cout << "  [-h]\n\n";
+}
+
+void
+true_or_error(bool cond, const std::string& msg)
+{
+  if (!cond)
+    throw std::runtime_error("condition failed - " + msg);
+}
+
+// Number of partial syncs issued by syncing the patched module
+size_t
+sync(const xrt::module& module)
+{
+  auto before = xrt_core::module_int::get_patch_sync_count(module);
+  xrt_core::module_int::sync(module);
+  return xrt_core::module_int::get_patch_sync_count(module) - before;
+}
+
+void
+test_patch_sync(const xrt::device& device, const std::string& elf_fnm, const std::string& kname)
+{
+  xrt::elf elf{elf_fnm};
+  xrt::hw_context ctx{device, elf};
+  xrt::kernel kernel{ctx, kname};
+  xrt::run run{kernel};
+
+  // Two buffers per global argument to patch back and forth
+  std::vector<std::pair<int, std::vector<xrt::bo>>> globals;
+  for (auto arg : xrt_core::kernel_int::get_args(kernel)) {
+    if (arg->index == xrt_core::xclbin::kernel_argument::no_index)
+      continue;
+
+    auto idx = static_cast<int>(arg->index);
+    if (arg->type == xrt_core::xclbin::kernel_argument::argtype::global) {
+      std::vector<xrt::bo> bos;
+      for (int i = 0; i < 2; ++i)
+        bos.emplace_back(ctx, buffer_size, xrt::bo::flags::host_only, kernel.group_id(idx));
+      run.set_arg(idx, bos[0]);
+      globals.emplace_back(idx, std::move(bos));
+    }
+    else {
+      std::vector<uint8_t> zero(arg->size, 0);
+      xrt_core::kernel_int::set_arg_at_index(run, idx, zero.data(), zero.size());
+    }
+  }
+  true_or_error(!globals.empty(), "kernel '" + kname + "' has no buffer arguments");
+
+  auto module = xrt_core::kernel_int::get_module(run);
+  true_or_error(bool(module), "kernel '" + kname + "' has no control code module");
+
+  // The first sync copies the whole buffer
+  true_or_error(sync(module) == 0, "expected a full sync of the instruction buffer");
+
+  // A sync without patches copies nothing
+  true_or_error(sync(module) == 0, "expected no sync without patches");
+
+  size_t total = 0;
+  for (auto& [idx, bos] : globals) {
+    run.set_arg(idx, bos[1]);
+    auto once = sync(module);
+    true_or_error(once > 0, "expected a partial sync of argument " + std::to_string(idx));
+
+    // Repeated patches of the same sites coalesce
+    run.set_arg(idx, bos[0]);
+    run.set_arg(idx, bos[1]);
+    run.set_arg(idx, bos[0]);
+    auto thrice = sync(module);
+    std::cout << "argument " << idx << ": " << once << " sync(s) patched once, "
+              << thrice << " sync(s) patched three times\n";
+    true_or_error(thrice == once, "expected repeated patches of argument " + std::to_string(idx) + " to coalesce");
+    total += once;
+  }
+
+  // Patches of all arguments before one sync merge where they are
+  // close, and never take more syncs than patching them one by one
+  for (auto& [idx, bos] : globals)
+    run.set_arg(idx, bos[1]);
+  auto all = sync(module);
+  std::cout << "all arguments: " << all << " sync(s), " << total << " sync(s) one by one\n";
+  true_or_error(all > 0 && all <= total, "expected patches of all arguments to coalesce");
+}
+
+int
+run(int argc, char** argv)
+{
+  if (argc < 2) {
+    usage();
+    return 1;
+  }
+
+  std::string elf_fnm;
+  std::string kname;
+  unsigned int device_index = 0;
+
+  std::vector<std::string> args{argv + 1, argv + argc};
+  std::string cur;
+  for (const auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return 0;
+    }
+
+    if (arg[0] == '-')
+      cur = arg.substr(arg.find_first_not_of("-"));
+    else if (cur == "elf")
+      elf_fnm = arg;
+    else if (cur == "kernel")
+      kname = arg;
+    else if (cur == "device")
+      device_index = std::stoi(arg);
+  }
+
+  if (elf_fnm.empty() || kname.empty()) {
+    usage();
+    return 1;
+  }
+
+  xrt::device device{device_index};
+  test_patch_sync(device, elf_fnm, kname);
+  return 0;
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  try {
+    auto ret = run(argc, argv);
+    std::cout << (ret ? "TEST FAILED\n" : "TEST PASSED\n");
+    return ret;
+  }
+  catch (const std::exception& ex) {
+    std::cerr << "Error: " << ex.what() << '\n';
+  }
+  std::cout << "TEST FAILED\n";
+  return 1;
+}
@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Verify execution order and error handling of xrt::rungraph.
+//
+// % rungraph --xclbin <file> --kernel <name>
+//
+// The test runs on the noop shim, which completes commands after a
+// fixed delay without hardware.  Any PL xclbin can be used.
+//
+// A diamond shaped graph, a -> {b, c} -> d, must start each run only
+// after the runs it depends on have completed.
+//
+// A graph where one of two roots fails to start must skip the
+// dependents of the failed root, complete the other root, and report
+// the failure from both wait() and every subsequent call to state()
+// until the graph is executed again.  The start failure is forced by
+// starting the root outside of the graph while the graph executes.
+
+#include "xrt/xrt_bo.h"
+#include "xrt/xrt_device.h"
+#include "xrt/xrt_hw_context.h"
+#include "xrt/xrt_kernel.h"
+#include "xrt/experimental/xrt_ini.h"
+#include "xrt/experimental/xrt_kernel.h"
+#include "xrt/experimental/xrt_xclbin.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Noop command completion delay, long enough for a run started
+// outside of the graph to be running when the graph starts it
+constexpr unsigned int completion_delay_us = 100000;
+
+void
+usage()
+{
+  std::cout << "usage: rungraph [options]\n\n";
+  std::cout << "  --xclbin <file>\n";
+  std::cout << "  --kernel <name>\n";
+  std::cout << "  [-h]\n\n";
+}
+
+void
+true_or_error(bool cond, const std::string& msg)
+{
+  if (!cond)
+    throw std::runtime_error("condition failed - " + msg);
+}
+
+struct kernel_context
+{
+  xrt::device device;
+  xrt::hw_context hwctx;
+  xrt::kernel kernel;
+  std::vector<xrt::bo> bos;
+  std::vector<std::vector<char>> scalars;
+
+  kernel_context(const std::string& xclbin_fnm, const std::string& kname)
+    : device(0)
+    , hwctx(device, device.register_xclbin(xrt::xclbin{xclbin_fnm}))
+    , kernel(hwctx, kname)
+  {
+    auto xkernel = hwctx.get_xclbin().get_kernel(kname);
+    for (const auto& arg : xkernel.get_args()) {
+      auto idx = arg.get_index();
+      if (idx >= bos.size()) {
+        bos.resize(idx + 1);
+        scalars.resize(idx + 1);
+      }
+      auto type = arg.get_host_type();
+      if (!type.empty() && type.back() == '*')
+        bos[idx] = xrt::bo(device, 4096, kernel.group_id(static_cast<int>(idx)));
+      else
+        scalars[idx].resize(arg.get_size());
+    }
+  }
+
+  xrt::run
+  create_run() const
+  {
+    xrt::run run{kernel};
+    for (size_t idx = 0; idx < bos.size(); ++idx) {
+      if (bos[idx])
+        run.set_arg(static_cast<int>(idx), bos[idx]);
+      else if (!scalars[idx].empty())
+        run.set_arg(static_cast<int>(idx), static_cast<const void*>(scalars[idx].data()), scalars[idx].size());
+    }
+    return run;
+  }
+};
+
+// Completion order of runs, recorded by a callback that is added
+// before the run is added to the graph and therefore is called
+// before the graph starts the successors of the run
+struct completion_order
+{
+  std::atomic<int> m_next {0};
+  std::vector<int> m_order;
+
+  explicit completion_order(size_t nruns)
+    : m_order(nruns, -1)
+  {}
+
+  void
+  track(xrt::run& run, size_t idx)
+  {
+    run.add_callback(ERT_CMD_STATE_COMPLETED,
+                     [this, idx](const void*, ert_cmd_state, void*) { m_order[idx] = m_next++; },
+                     nullptr);
+  }
+
+  int
+  operator[](size_t idx) const
+  {
+    return m_order[idx];
+  }
+};
+
+void
+test_diamond(const kernel_context& ctx)
+{
+  enum { a, b, c, d, nruns };
+  std::vector<xrt::run> runs;
+  for (int i = 0; i < nruns; ++i)
+    runs.push_back(ctx.create_run());
+
+  completion_order order(nruns);
+  for (int i = 0; i < nruns; ++i)
+    order.track(runs[i], i);
+
+  xrt::rungraph graph{ctx.hwctx};
+  graph.add(runs[a]);
+  graph.add(runs[b], {runs[a]});
+  graph.add(runs[c], {runs[a]});
+  graph.add(runs[d], {runs[b], runs[c]});
+
+  for (int iter = 0; iter < 2; ++iter) {
+    graph.execute();
+    graph.wait();
+    true_or_error(graph.state() == ERT_CMD_STATE_COMPLETED, "expected completed graph");
+    true_or_error(order[a] < order[b] && order[a] < order[c], "b and c must complete after a");
+    true_or_error(order[d] > order[b] && order[d] > order[c], "d must complete after b and c");
+  }
+}
+
+void
+test_failing_node(const kernel_context& ctx)
+{
+  enum { ok, bad, join, nruns };
+  std::vector<xrt::run> runs;
+  for (int i = 0; i < nruns; ++i)
+    runs.push_back(ctx.create_run());
+
+  xrt::rungraph graph{ctx.hwctx};
+  graph.add(runs[ok]);
+  graph.add(runs[bad]);
+  graph.add(runs[join], {runs[ok], runs[bad]});
+
+  // The graph cannot start a run that is already running
+  runs[bad].start();
+  graph.execute();
+
+  bool thrown = false;
+  try {
+    graph.wait();
+  }
+  catch (const std::exception& ex) {
+    std::cout << "expected error: " << ex.what() << '\n';
+    thrown = true;
+  }
+  true_or_error(thrown, "expected wait() to throw on failed node");
+  runs[bad].wait();
+
+  // The failure is retained after wait() has thrown
+  for (int i = 0; i < 2; ++i)
+    true_or_error(graph.state() == ERT_CMD_STATE_ABORT, "expected aborted graph state after wait");
+  true_or_error(runs[ok].state() == ERT_CMD_STATE_COMPLETED, "expected independent root to complete");
+
+  // Polling reports the failure on every call
+  runs[bad].start();
+  graph.execute();
+  while (graph.state() == ERT_CMD_STATE_RUNNING)
+    ;
+  for (int i = 0; i < 2; ++i)
+    true_or_error(graph.state() == ERT_CMD_STATE_ABORT, "expected aborted graph state when polled");
+  runs[bad].wait();
+
+  // A successful execution clears the failure
+  graph.execute();
+  graph.wait();
+  true_or_error(graph.state() == ERT_CMD_STATE_COMPLETED, "expected completed graph after failure");
+  true_or_error(runs[join].state() == ERT_CMD_STATE_COMPLETED, "expected join to complete after failure");
+}
+
+int
+run(int argc, char** argv)
+{
+  if (argc < 2) {
+    usage();
+    return 1;
+  }
+
+  std::string xclbin_fnm;
+  std::string kname;
+
+  std::vector<std::string> args{argv + 1, argv + argc};
+  std::string cur;
+  for (const auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return 0;
+    }
+
+    if (arg[0] == '-')
+      cur = arg.substr(arg.find_first_not_of("-"));
+    else if (cur == "xclbin")
+      xclbin_fnm = arg;
+    else if (cur == "kernel")
+      kname = arg;
+  }
+
+  if (xclbin_fnm.empty() || kname.empty()) {
+    usage();
+    return 1;
+  }
+
+  // Select the noop shim before the first device is opened
+  setenv("XCL_EMULATION_MODE", "noop", 1); // NOLINT
+  xrt::ini::set("Runtime.noop_completion_delay_us", completion_delay_us);
+
+  kernel_context ctx{xclbin_fnm, kname};
+  test_diamond(ctx);
+  test_failing_node(ctx);
+  return 0;
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+  try {
+    auto ret = run(argc, argv);
+    std::cout << (ret ? "TEST FAILED\n" : "TEST PASSED\n");
+    return ret;
+  }
+  catch (const std::exception& ex) {
+    std::cerr << "Error: " << ex.what() << '\n';
+  }
+  std::cout << "TEST FAILED\n";
+  return 1;
+}
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2020-2022 Xilinx, Inc
-// Copyright (C) 2022-2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 // This file implements XRT BO APIs as declared in
 // core/include/experimental/xrt_bo.h
@@ -21,6 +21,8 @@
 #include "hw_context_int.h"
 #include "kernel_int.h"
 #include "core/common/api/bo_int.h"
+#include "core/common/bo_cache.h"
+#include "core/common/config_reader.h"
 #include "core/common/device.h"
 #include "core/common/memalign.h"
 #include "core/common/message.h"
@@ -35,6 +37,7 @@
 
 #include <cstdlib>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -724,6 +727,28 @@ public:
   }
 };
 
+// class buffer_pbuf - Pooled kernel driver host side buffer
+//
+// Kernel driver allocated host side buffer obtained from a per device
+// bo_pool.  The mapped buffer handle is returned to the pool when the
+// last reference to the handle is released.
+class buffer_pbuf : public bo_impl
+{
+  void* hbuf;
+
+public:
+  buffer_pbuf(const device_type& dev, std::shared_ptr<xrt_core::buffer_handle> bhdl, size_t sz, void* map)
+    : bo_impl(dev, std::move(bhdl), sz)
+    , hbuf(map)
+  {}
+
+  void*
+  get_hbuf() const override
+  {
+    return hbuf;
+  }
+};
+
 // class buffer_imported - Buffer imported from another device
 //
 // The exported buffer handle is an opaque type from a call
@@ -1014,6 +1039,23 @@ public:
 
 } // namespace xrt
 
+////////////////////////////////////////////////////////////////
+// xrt_core::device BO pool API definition
+////////////////////////////////////////////////////////////////
+// Pooled BOs are zero filled when reused, same as BOs allocated
+// from the driver.
+std::shared_ptr<xrt_core::bo_pool>
+xrt_core::device::
+get_bo_pool(uint64_t flags, size_t size)
+{
+  std::lock_guard<std::mutex> lk(m_mutex);
+  auto& pool = m_bo_pools[flags];
+  if (!pool)
+    pool = std::make_shared<xrt_core::bo_pool>(this, flags, size, size / 2, true);
+
+  return pool;
+}
+
 // Implementation details
 namespace {
 
@@ -1069,6 +1111,43 @@ alloc_bo(const device_type& device, size_t sz, xrtBufferFlags flags, xrtMemoryGr
   }
 }
 
+// Pools of host only and cacheable buffers per device and BO flags.
+// Pooling is enabled with Runtime.bo_pool_size_mb and applies only to
+// buffers allocated outside a hardware context since pooled buffers
+// can outlive the context.  The pools are owned by the device.
+static std::shared_ptr<xrt_core::bo_pool>
+get_bo_pool(const device_type& device, xrtBufferFlags flags, xrtMemoryGroup grp)
+{
+  static const size_t pool_size = static_cast<size_t>(xrt_core::config::get_bo_pool_size_mb()) << 20;
+  if (!pool_size || device.get_hwctx_handle())
+    return nullptr;
+
+  // Embed grp in flags
+  xcl_bo_flags xflags{flags};
+  xcl_bo_flags xgrp{grp};
+  xflags.bank = xgrp.bank;
+  xflags.slot = xgrp.slot;
+
+  return device.get_device()->get_bo_pool(xflags.all, pool_size);
+}
+
+// driver allocates host buffer from pool
+static std::shared_ptr<xrt::bo_impl>
+alloc_pbuf(const device_type& device, const std::shared_ptr<xrt_core::bo_pool>& pool, size_t sz)
+{
+  XRT_TRACE_POINT_SCOPE(xrt_bo_alloc_pbuf);
+  auto bo = pool->alloc(sz);
+  auto map = bo.map;
+  auto bosz = bo.size;
+  std::shared_ptr<xrt_core::buffer_handle> handle
+    {bo.handle.release(), [pool, map, bosz](xrt_core::buffer_handle* hdl) {
+       pool->release({std::unique_ptr<xrt_core::buffer_handle>(hdl), map, bosz});
+     }};
+  auto boh = std::make_shared<xrt::buffer_pbuf>(device, std::move(handle), sz, map);
+  boh->get_usage_logger()->log_buffer_info_construct(device->get_device_id(), sz, device.get_hwctx_handle());
+  return boh;
+}
+
 // driver allocates host buffer
 static std::shared_ptr<xrt::bo_impl>
 alloc_kbuf(const device_type& device, size_t sz, xrtBufferFlags flags, xrtMemoryGroup grp)
@@ -1156,8 +1235,11 @@ alloc(const device_type& device, size_t sz, xrtBufferFlags flags, xrtMemoryGroup
       return alloc_hbuf(device, xrt_core::aligned_alloc(get_alignment(), sz), sz, flags, grp);
 #endif
   case XCL_BO_FLAGS_CACHEABLE:
-  case XCL_BO_FLAGS_SVM:
   case XCL_BO_FLAGS_HOST_ONLY:
+    if (auto pool = get_bo_pool(device, flags, grp))
+      return alloc_pbuf(device, pool, sz);
+    return alloc_kbuf(device, sz, flags, grp);
+  case XCL_BO_FLAGS_SVM:
   case XCL_BO_FLAGS_P2P:
   case XCL_BO_FLAGS_EXECBUF:
     return alloc_kbuf(device, sz, flags, grp);
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2020-2022 Xilinx, Inc. All rights reserved.
-// Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2023-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 // This file implements XRT kernel APIs as declared in
 // core/include/experimental/xrt_kernel.h
@@ -42,6 +42,7 @@
 #include "core/common/error.h"
 #include "core/common/message.h"
 #include "core/common/system.h"
+#include "core/common/time.h"
 #include "core/common/trace.h"
 #include "core/common/usage_metrics.h"
 #include "core/common/xclbin_parser.h"
@@ -57,6 +58,7 @@
 #include <cstdarg>
 #include <cstdint>
 #include <cstdlib>
+#include <exception>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -703,6 +705,112 @@ private:
     return static_cast<ert_cmd_state>(pkt->state);
   }
 
+  static xrt::run_wait_policy
+  get_default_wait_policy()
+  {
+    static auto policy = (xrt_core::config::get_run_wait_policy() == "hybrid")
+      ? xrt::run_wait_policy::hybrid
+      : xrt::run_wait_policy::block;
+    return policy;
+  }
+
+  // Spin budget for hybrid wait.  The budget is twice the average
+  // completion time of recent runs, which gives room for jitter, and
+  // zero if recent runs take longer than the configured upper bound.
+  // An unknown completion time (first run) uses the upper bound.
+  unsigned long long
+  get_spin_budget_ns() const
+  {
+    static const unsigned long long max_spin_ns = 1000ULL * xrt_core::config::get_run_wait_spin_us();
+    auto avg_ns = m_avg_completion_ns.load(std::memory_order_relaxed);
+    if (!avg_ns)
+      return max_spin_ns;
+    if (avg_ns > max_spin_ns)
+      return 0;
+    return std::min(2 * avg_ns, max_spin_ns);
+  }
+
+  // Update average completion time with the current run.  The sample
+  // is the time from run() until completion was observed, either by
+  // the command monitor (managed) or by a waiting thread that saw the
+  // command complete (unmanaged).  Only the first observation of a
+  // run is sampled.  Must be called with m_mutex locked.
+  void
+  record_completion(unsigned long long done_ns) const
+  {
+    if (m_sampled)
+      return;
+
+    m_sampled = true;
+    auto elapsed = done_ns - m_start_ns;
+    auto avg_ns = m_avg_completion_ns.load(std::memory_order_relaxed);
+    m_avg_completion_ns.store(avg_ns ? (7 * avg_ns + elapsed) / 8 : elapsed, std::memory_order_relaxed);
+  }
+
+  // Record completion observed by a thread waiting for an unmanaged
+  // command.  Managed commands are sampled in notify().
+  void
+  record_unmanaged_completion() const
+  {
+    if (m_managed)
+      return;
+
+    auto done_ns = xrt_core::time_ns();
+    std::lock_guard<std::mutex> lk(m_mutex);
+    record_completion(done_ns);
+  }
+
+  // An unmanaged command that completed before wait() was called
+  // cannot be sampled, its completion time is unknown.
+  void
+  skip_stale_completion() const
+  {
+    if (m_managed || get_state_raw() < ERT_CMD_STATE_COMPLETED)
+      return;
+
+    std::lock_guard<std::mutex> lk(m_mutex);
+    m_sampled = true;
+  }
+
+  // Poll command state for up to budget_ns nanoseconds.  Return true
+  // if the command completed.
+  bool
+  spin_wait(unsigned long long budget_ns) const
+  {
+    auto start = xrt_core::time_ns();
+    do {
+      if (m_managed) {
+        std::lock_guard<std::mutex> lk(m_mutex);
+        if (m_done)
+          return true;
+      }
+      else if (get_state() >= ERT_CMD_STATE_COMPLETED) {
+        record_unmanaged_completion();
+        return true;
+      }
+    } while (xrt_core::time_ns() - start < budget_ns);
+
+    return false;
+  }
+
+  // Spin before blocking if hybrid wait policy.  The native profiling
+  // hooks record each spin attempt and each fall back to blocking, so
+  // the profile summary shows how often each path was taken.
+  bool
+  try_spin_wait() const
+  {
+    if (m_wait_policy != xrt::run_wait_policy::hybrid)
+      return false;
+
+    auto budget = get_spin_budget_ns();
+    if (!budget)
+      return false;
+
+    return xdp::native::profiling_wrapper("xrt::run::wait(spin)",
+      [this, budget] {
+        return spin_wait(budget);
+      });
+  }
 
 public:
   explicit
@@ -712,6 +820,7 @@ public:
     , m_hwctx(std::move(hwctx))
     , m_execbuf(m_device->create_exec_buf<ert_start_kernel_cmd>())
     , m_done(true)
+    , m_wait_policy(get_default_wait_policy())
   {
     static unsigned int count = 0;
     m_uid = count++;
@@ -858,6 +967,12 @@ public:
       (*cb)(state);
   }
 
+  void
+  set_wait_policy(xrt::run_wait_policy policy)
+  {
+    m_wait_policy = policy;
+  }
+
   // Submit the command for execution.
   void
   run()
@@ -868,6 +983,8 @@ public:
         throw std::runtime_error("bad command state, can't launch");
       m_managed = (m_callbacks && !m_callbacks->empty());
       m_done = false;
+      m_sampled = false;
+      m_start_ns = xrt_core::time_ns();
     }
     if (m_managed)
       m_hwqueue.managed_start(this);
@@ -879,13 +996,24 @@ public:
   ert_cmd_state
   wait() const
   {
-    if (m_managed) {
-      std::unique_lock<std::mutex> lk(m_mutex);
-      while (!m_done)
-        m_exec_done.wait(lk);
-    }
-    else {
-      m_hwqueue.wait(this);
+    skip_stale_completion();
+    if (!try_spin_wait()) {
+      auto block = [this] {
+        if (m_managed) {
+          std::unique_lock<std::mutex> lk(m_mutex);
+          while (!m_done)
+            m_exec_done.wait(lk);
+        }
+        else {
+          m_hwqueue.wait(this);
+          record_unmanaged_completion();
+        }
+      };
+
+      if (m_wait_policy == xrt::run_wait_policy::hybrid)
+        xdp::native::profiling_wrapper("xrt::run::wait(block)", block);
+      else
+        block();
     }
 
     return get_state_raw(); // state wont change after wait
@@ -894,14 +1022,29 @@ public:
   std::pair<ert_cmd_state, std::cv_status>
   wait(const std::chrono::milliseconds& timeout_ms) const
   {
-    if (m_managed) {
-      std::unique_lock<std::mutex> lk(m_mutex);
-      while (!m_done)
-        if (m_exec_done.wait_for(lk, timeout_ms) == std::cv_status::timeout)
-          return {get_state_raw(), std::cv_status::timeout};
-    }
-    else {
-      if (m_hwqueue.wait(this, timeout_ms) == std::cv_status::timeout)
+    skip_stale_completion();
+    if (!try_spin_wait()) {
+      auto block = [this, &timeout_ms] {
+        if (m_managed) {
+          std::unique_lock<std::mutex> lk(m_mutex);
+          while (!m_done)
+            if (m_exec_done.wait_for(lk, timeout_ms) == std::cv_status::timeout)
+              return std::cv_status::timeout;
+        }
+        else {
+          auto status = m_hwqueue.wait(this, timeout_ms);
+          if (status == std::cv_status::no_timeout)
+            record_unmanaged_completion();
+          return status;
+        }
+        return std::cv_status::no_timeout;
+      };
+
+      auto status = (m_wait_policy == xrt::run_wait_policy::hybrid)
+        ? xdp::native::profiling_wrapper("xrt::run::wait(block)", block)
+        : block();
+
+      if (status == std::cv_status::timeout)
         return {get_state_raw(), std::cv_status::timeout};
     }
 
@@ -952,6 +1095,8 @@ public:
         return;
 
       XRT_DEBUGF("kernel_command::notify() m_uid(%d) m_state(%d)\n", m_uid, s);
+      if (m_managed)
+        record_completion(xrt_core::time_ns());
       complete = m_done = true;
       callbacks = (m_callbacks && !m_callbacks->empty());
     }
@@ -985,6 +1130,14 @@ private:
   mutable std::condition_variable m_exec_done;
 
   std::unique_ptr<callback_list> m_callbacks;
+
+  // Hybrid wait policy, start time of current run and moving
+  // average of recent completion times.  The start time and sampled
+  // flag are protected by m_mutex, the average is read unlocked.
+  std::atomic<xrt::run_wait_policy> m_wait_policy;
+  unsigned long long m_start_ns = 0;
+  mutable bool m_sampled = false;
+  mutable std::atomic<unsigned long long> m_avg_completion_ns {0};
 };
 
 // class argument - get argument value from va_arg
@@ -2076,6 +2229,36 @@ class run_impl : public std::enable_shared_from_this<run_impl>
     return xrt_core::bo::clone(bo, kernel->group_id(index));
   }
 
+  // Check if argument at index is bound to specified BO by a previous
+  // set_arg.  A weak reference to the BO is kept so that the run
+  // object doesn't extend the lifetime of the BO, while the control
+  // block of the reference guarantees that a new BO can't alias a
+  // destructed BO.
+  bool
+  is_bound_at_index(size_t index, const xrt::bo& bo) const
+  {
+    if (index >= m_arg_bos.size())
+      return false;
+
+    const auto& bound = m_arg_bos[index];
+    const auto& handle = bo.get_handle();
+    return !bound.expired() && !bound.owner_before(handle) && !handle.owner_before(bound);
+  }
+
+  void
+  bind_at_index(size_t index, const xrt::bo& bo)
+  {
+    if (index < m_arg_bos.size())
+      m_arg_bos[index] = bo.get_handle();
+  }
+
+  void
+  unbind_at_index(size_t index)
+  {
+    if (index < m_arg_bos.size())
+      m_arg_bos[index].reset();
+  }
+
   // Clone the commmand packet of another run_impl
   // Used when constructing a run_impl from another run_impl
   // for concurrent execution
@@ -2141,6 +2324,7 @@ class run_impl : public std::enable_shared_from_this<run_impl>
   uint32_t m_header;                      // cached intialized command header
   uint32_t uid;                           // internal unique id for debug
   std::unique_ptr<arg_setter> asetter;    // helper to populate payload data
+  std::vector<std::weak_ptr<xrt::bo_impl>> m_arg_bos; // BO bound per arg index
   bool encode_cumasks = false;            // indicate if cmd cumasks must be re-encoded
   std::shared_ptr<xrt_core::usage_metrics::base_logger> m_usage_logger =
       xrt_core::usage_metrics::get_usage_metrics_logger();
@@ -2191,6 +2375,7 @@ public:
     , data(initialize_command(cmd.get()))
     , m_header(0)
     , uid(create_uid())
+    , m_arg_bos(kernel->get_args().size())
   {
     XRT_DEBUGF("run_impl::run_impl(%d)\n" , uid);
   }
@@ -2209,6 +2394,7 @@ public:
     , data(clone_command_data(rhs))
     , m_header(rhs->m_header)
     , uid(create_uid())
+    , m_arg_bos(rhs->m_arg_bos)
     , encode_cumasks(rhs->encode_cumasks)
   {
     XRT_DEBUGF("run_impl::run_impl(%d)\n" , uid);
@@ -2298,6 +2484,12 @@ public:
     encode_cumasks = true;
   }
 
+  const xrt::module&
+  get_module() const
+  {
+    return m_module;
+  }
+
   const std::bitset<max_cus>&
   get_cumask() const
   {
@@ -2313,6 +2505,7 @@ public:
   void
   set_arg_value(const argument& arg, const arg_range<uint8_t>& value)
   {
+    unbind_at_index(arg.index());
     get_arg_setter()->set_arg_value(arg, value);
   }
 
@@ -2350,15 +2543,29 @@ public:
   void
   set_arg(const argument& arg, std::va_list* args)
   {
+    unbind_at_index(arg.index());
     arg.set(get_arg_setter(), args);
   }
 
   void
   set_arg_at_index(size_t index, const xrt::bo& argbo)
   {
+    // Re-setting the BO that is already bound to the argument is a
+    // no-op.  The command packet, the CU connectivity filtering, and
+    // any module patching are still valid from the previous set_arg.
+    if (is_bound_at_index(index, argbo))
+      return;
+
     auto bo = validate_bo_at_index(index, argbo);
     auto& arg = kernel->get_arg(index);
     set_arg_value(arg, bo);
+
+    // A local copy of the argument BO must be refreshed on every
+    // set_arg, so only the BO itself is tracked.
+    if (bo.get_handle() == argbo.get_handle())
+      bind_at_index(index, bo);
+    else
+      unbind_at_index(index);
   }
 
   void
@@ -2485,6 +2692,12 @@ public:
     m_hwqueue.submit_signal(fence);
   }
 
+  void
+  set_wait_policy(xrt::run_wait_policy policy)
+  {
+    cmd->set_wait_policy(policy);
+  }
+
   void
   stop()
   {
@@ -2806,6 +3019,10 @@ public:
     auto mtype = k->get_mailbox_type();
     m_readonly = (mtype == mailbox_type::out);
     m_writeonly = (mtype == mailbox_type::in);
+
+    // Arguments are written through to the mailbox, so re-setting an
+    // argument to the same BO must not be skipped.
+    m_arg_bos.clear();
   }
 
   //Aquring mailbox read and write if not acquired already.
@@ -3040,15 +3257,26 @@ public:
 //
 // Execution of a runlist is carved into multiple
 // submissions of chained ert commands.  The size
-// of a chain is currently hardwired, but at some
-// point will be dyanmic.
+// of a chain is configurable (Runtime.runlist_chain_size)
+// or adapted to the observed per run latency.
+//
+// Runs are prepared and submitted one chain at a time
+// such that the first chains execute while the runs
+// of later chains are prepared.
 class runlist_impl
 {
-  static constexpr size_t submit_size = 24;
+  static constexpr size_t max_chain_size = 64;
+  static constexpr size_t min_chain_size = 4;
+  static constexpr size_t default_chain_size = 24;
   static constexpr size_t noidx = std::numeric_limits<size_t>::max();
-  static constexpr size_t execbuf_size = sizeof(ert_packet) + sizeof(ert_cmd_chain_data) + submit_size * sizeof(uint64_t);
+  static constexpr size_t execbuf_size = sizeof(ert_packet) + sizeof(ert_cmd_chain_data) + max_chain_size * sizeof(uint64_t);
   static constexpr size_t word_size = sizeof(uint32_t); // ert payload word size
 
+  // Adaptive chain sizing targets this execution time per chain.
+  // Tiny runs are chained in large chains to amortize submission,
+  // long runs in small chains to start execution sooner.
+  static constexpr uint64_t adaptive_chain_ns = 200000;
+
   // The runlist creates its own execution buffers, which are
   // ert_packets with payload interpreted as ert_cmd_chain_data
   using cmd_type = ert_packet;
@@ -3064,7 +3292,7 @@ class runlist_impl
   std::vector<xrt_core::buffer_handle*> m_bos;
 
   // Commands are submitted in chained ert commands where the number
-  // of chained commands in less than 'submit_size'. The ert chained
+  // of chained commands in at most 'm_chain_size'. The ert chained
   // commands are created when run objects are added to the runlist.
   // The created commands are owned by m_cmds, but passed around as
   // pointers. Successfully submitted chained commands are added to
@@ -3072,6 +3300,21 @@ class runlist_impl
   std::vector<execbuf_type> m_cmds;
   std::vector<execbuf_type*> m_submitted_cmds;
 
+  // Number of runs per chained command.  With adaptive sizing the
+  // chain size is recomputed from the average per run latency prior
+  // to execution, and the runs are re-chained if the size changed.
+  size_t m_chain_size;
+  bool m_adaptive;
+  uint64_t m_execute_ns = 0;  // time of last execute
+  uint64_t m_avg_run_ns = 0;  // moving average of per run latency
+
+  static size_t
+  get_configured_chain_size()
+  {
+    auto size = xrt_core::config::get_runlist_chain_size();
+    return size ? std::min<size_t>(size, max_chain_size) : default_chain_size;
+  }
+
   static const std::string&
   state_to_string(state st)
   {
@@ -3115,15 +3358,87 @@ class runlist_impl
   // when commands are added to the runlist.  Here we
   // get the cmd that chains the run at specified index.
   execbuf_type*
-  get_cmd_chain_for_run_at_index(size_t runidx)
+  get_cmd_chain_for_run_at_index(std::vector<execbuf_type>& cmds, size_t chain_size, size_t runidx)
+  {
+    auto idx = runidx / chain_size;
+    if (idx < cmds.size())
+      return &cmds[idx];
+
+    cmds.push_back(create_exec_buf());
+    m_submitted_cmds.reserve(cmds.size());
+    return &cmds.at(idx);
+  }
+
+  // Chain run_bo as the next command of execbuf.  May throw, but
+  // the chained command is not changed until commit_chained_run().
+  static void
+  chain_run(execbuf_type* execbuf, xrt_core::buffer_handle* run_bo)
   {
-    auto idx = runidx / submit_size;
-    if (idx < m_cmds.size())
-      return &m_cmds[idx];
+    auto [cmd, pkt] = unpack(execbuf);
+    auto chain_data = get_ert_cmd_chain_data(pkt);
+    auto run_bo_props = run_bo->get_properties();
 
-    m_cmds.push_back(create_exec_buf());
-    m_submitted_cmds.reserve(m_cmds.size());
-    return &m_cmds.at(idx);
+    auto data_idx = chain_data->command_count;
+    chain_data->data[data_idx] = run_bo_props.kmhdl;
+
+    // Let shim handle binding of run_bo arguments to the command
+    // that cahins the run_bo.  This allows pinning if necessary.
+    cmd->bind_at(data_idx, run_bo, 0, run_bo_props.size);
+  }
+
+  static void
+  commit_chained_run(execbuf_type* execbuf)
+  {
+    auto [cmd, pkt] = unpack(execbuf);
+    auto chain_data = get_ert_cmd_chain_data(pkt);
+    chain_data->command_count++;
+    pkt->count += sizeof(uint64_t) / word_size; // account for added command
+  }
+
+  // Re-chain all runs in chains of specified size.  The runlist is
+  // idle.  The current chains are unchanged if re-chaining throws.
+  void
+  rechain(size_t chain_size)
+  {
+    std::vector<execbuf_type> cmds;
+    for (size_t runidx = 0; runidx < m_bos.size(); ++runidx) {
+      auto execbuf = get_cmd_chain_for_run_at_index(cmds, chain_size, runidx);
+      chain_run(execbuf, m_bos[runidx]);
+      commit_chained_run(execbuf);
+    }
+
+    m_cmds = std::move(cmds);
+    m_chain_size = chain_size;
+  }
+
+  // Chain size for which a chain executes in about adaptive_chain_ns
+  // given the average per run latency.  The size is a power of 2 to
+  // avoid re-chaining on small variations in latency.
+  size_t
+  get_adaptive_chain_size() const
+  {
+    if (!m_avg_run_ns)
+      return m_chain_size;
+
+    auto size = std::clamp<uint64_t>(adaptive_chain_ns / m_avg_run_ns, min_chain_size, max_chain_size);
+    size_t chain_size = min_chain_size;
+    while (chain_size * 2 <= size)
+      chain_size *= 2;
+    return chain_size;
+  }
+
+  // Record per run latency of a completed execution.  Only called
+  // when wait() blocked until the last command completed, otherwise
+  // the elapsed time includes time spent by the application between
+  // execute() and wait() after the commands completed.
+  void
+  record_completion()
+  {
+    if (!m_adaptive || m_runlist.empty())
+      return;
+
+    auto per_run_ns = (xrt_core::time_ns() - m_execute_ns) / m_runlist.size();
+    m_avg_run_ns = m_avg_run_ns ? (3 * m_avg_run_ns + per_run_ns) / 4 : per_run_ns;
   }
 
   void
@@ -3226,7 +3541,8 @@ class runlist_impl
     for (auto execbuf : m_submitted_cmds) {
       auto state = get_completed_state(execbuf, 1ms);
       if (state == ERT_CMD_STATE_COMPLETED) {
-        runidx += submit_size;
+        auto [cmd, pkt] = unpack(execbuf);
+        runidx += get_ert_cmd_chain_data(pkt)->command_count;
         continue;
       }
 
@@ -3257,17 +3573,24 @@ class runlist_impl
     return std::cv_status::no_timeout;
   }
 
-  // Submit runlist in chunks of submit size.  Make a note of last
-  // submitted command; in case of submit failure at least the last
-  // successfully submitted command must be waited for before the list
-  // can be reset. Pre-condition ensured by execute() is that size of
-  // runlist is greater than 0.
+  // Prepare and submit runlist one chained command at a time such
+  // that execution of the first chains overlaps with preparation of
+  // runs in later chains.  Make a note of last submitted command; in
+  // case of failure at least the last successfully submitted command
+  // must be waited for before the list can be reset. Pre-condition
+  // ensured by execute() is that size of runlist is greater than 0.
   void
   submit()
   {
     m_submitted_cmds.clear();
+    m_execute_ns = xrt_core::time_ns();
+    size_t runidx = 0;
     for (auto& execbuf : m_cmds) {
       auto [cmd, pkt] = unpack(execbuf);
+      auto end = runidx + get_ert_cmd_chain_data(pkt)->command_count;
+      for (; runidx < end; ++runidx)
+        m_runlist[runidx].get_handle()->prep_start(); // can throw
+
       pkt->state = ERT_CMD_STATE_NEW;
       // m_submitted commands reflect what has been successfully
       // submitted to the hwqueue. Resize to avoid exception during
@@ -3291,6 +3614,8 @@ public:
     : m_exec_buffer_cache{hwctx.get_device().get_handle(), 128}
     , m_hwctx{std::move(hwctx)}
     , m_hwqueue{m_hwctx}
+    , m_chain_size{get_configured_chain_size()}
+    , m_adaptive{xrt_core::config::get_runlist_chain_size() == 0}
   {}
 
   ~runlist_impl()
@@ -3315,22 +3640,14 @@ public:
     m_runlist.reserve(runidx + 1);
     m_bos.reserve(runidx + 1);
 
-    auto execbuf = get_cmd_chain_for_run_at_index(runidx);
-    auto [cmd, pkt] = unpack(execbuf);
-    auto chain_data = get_ert_cmd_chain_data(pkt);
+    auto execbuf = get_cmd_chain_for_run_at_index(m_cmds, m_chain_size, runidx);
     
     auto run_impl = run.get_handle();
     auto run_cmd = run_impl->get_cmd();
     auto run_bo = run_cmd->get_exec_bo();
-    auto run_bo_props = run_bo->get_properties();
 
-    auto data_idx = chain_data->command_count;
-    chain_data->data[data_idx] = run_bo_props.kmhdl;
-
-    // Let shim handle binding of run_bo arguments to the command
-    // that cahins the run_bo.  This allows pinning if necessary.
     // May throw, but so far no state change, so still safe.
-    cmd->bind_at(data_idx, run_bo, 0, run_bo_props.size); 
+    chain_run(execbuf, run_bo);
 
     // Once a run object is added to a list it will be in a state that
     // makes it impossible to add to another list or to same list
@@ -3341,8 +3658,7 @@ public:
     run_impl->set_runlist(this);  // throws or changes state of run
 
     // Non throwing state change
-    chain_data->command_count++;
-    pkt->count += sizeof(uint64_t) / word_size; // account for added command
+    commit_chained_run(execbuf);
     m_runlist.push_back(std::move(run));  // move of shared_ptr is noexcept
     m_bos.push_back(run_bo);              // ptr noexcept
   }
@@ -3356,9 +3672,11 @@ public:
     if (m_runlist.empty())
       return;
 
-    // Prep each run object
-    for (auto& run : m_runlist)
-      run.get_handle()->prep_start();
+    // Adapt chain size to latency observed in prior executions
+    if (m_adaptive) {
+      if (auto chain_size = get_adaptive_chain_size(); chain_size != m_chain_size)
+        rechain(chain_size);
+    }
 
     // Close the command list.
     m_state = state::closed;
@@ -3367,12 +3685,12 @@ public:
     // runlist is running.  This forces the user to call wait() even
     // as submit() throws.  The burden is on application to handle the
     // error properly while at least giving some hint as to where
-    // things failed.
+    // things failed.  If nothing was submitted, the runlist is idle.
     try {
       submit();
     }
     catch (const std::exception&) {
-      m_state = state::running;
+      m_state = m_submitted_cmds.empty() ? state::idle : state::running;
       throw;
     }
         
@@ -3389,11 +3707,17 @@ public:
     if (m_state != state::running)
       return std::cv_status::no_timeout;
 
+    // Completion time of the runlist is known only if the wait
+    // blocks until the last command completes
+    bool blocked = m_adaptive && poll_last_cmd() < ERT_CMD_STATE_COMPLETED;
+
     // Wait throws on error. On timeout just return
     if (wait(timeout) == std::cv_status::timeout)
       return std::cv_status::timeout;
 
     // On succesful wait, the runlist becomes idle
+    if (blocked)
+      record_completion();
     m_state = state::idle;
     return std::cv_status::no_timeout;
   }
@@ -3432,6 +3756,12 @@ public:
     }
   }
 
+  size_t
+  get_chain_size() const
+  {
+    return m_chain_size;
+  }
+
   void
   reset()
   {
@@ -3450,6 +3780,298 @@ public:
   }
 };
 
+// class rungraph_impl - The internals of a rungraph
+//
+// Each run object in the graph is a node with a count of
+// unfinished dependencies.  A node is started when the count
+// drops to zero.  Nodes without dependencies are started by
+// execute(), all other nodes are started from the completion
+// callback of the last dependency to finish, which executes
+// in the hw queue monitor thread.
+//
+// If a node fails, dependent nodes are not started but are
+// finished as aborted such that the graph still completes.
+class rungraph_impl
+{
+  struct node
+  {
+    xrt::run run;
+    std::vector<xrt::fence> fences;
+    std::vector<size_t> successors;
+    size_t ndeps = 0;
+
+    // Number of unfinished dependencies during execution
+    std::atomic<size_t> pending {0};
+
+    // Set when started by the graph, cleared upon completion.
+    // Guards against callbacks for runs not started by the graph.
+    std::atomic<bool> active {false};
+
+    node(xrt::run r, std::vector<xrt::fence> f)
+      : run(std::move(r)), fences(std::move(f))
+    {}
+  };
+
+  enum class state { idle, running };
+
+  xrt::hw_context m_hwctx;
+  std::vector<std::unique_ptr<node>> m_nodes;
+  std::map<const run_impl*, size_t> m_index;
+  state m_state = state::idle;
+
+  // Number of nodes not yet finished in current execution
+  std::atomic<size_t> m_outstanding {0};
+  std::atomic<bool> m_abort {false};
+
+  // First failing node if any, or exception from starting a node
+  mutable std::mutex m_mutex;
+  mutable std::condition_variable m_done;
+  size_t m_error_idx = 0;
+  ert_cmd_state m_error_state = ERT_CMD_STATE_COMPLETED;
+  std::exception_ptr m_exception;
+
+  void
+  record_error(size_t idx, ert_cmd_state state, std::exception_ptr eptr)
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    if (m_error_state == ERT_CMD_STATE_COMPLETED && !m_exception) {
+      m_error_idx = idx;
+      m_error_state = state;
+      m_exception = std::move(eptr);
+    }
+    m_abort = true;
+  }
+
+  // Start a node whose dependencies have all completed.  A start
+  // failure finishes the node as aborted.
+  void
+  release(size_t idx)
+  {
+    auto& nd = *m_nodes[idx];
+    try {
+      for (const auto& fence : nd.fences)
+        nd.run.submit_wait(fence);
+      nd.active = true;
+      nd.run.start();
+    }
+    catch (...) {
+      nd.active = false;
+      record_error(idx, ERT_CMD_STATE_ABORT, std::current_exception());
+      finish(idx, ERT_CMD_STATE_ABORT);
+    }
+  }
+
+  // Finish a node, release or skip the successors that have no more
+  // pending dependencies.  The graph is complete when the last node
+  // is finished.
+  void
+  finish(size_t idx, ert_cmd_state state)
+  {
+    if (state != ERT_CMD_STATE_COMPLETED && !m_abort)
+      record_error(idx, state, nullptr);
+
+    for (auto succ : m_nodes[idx]->successors) {
+      if (--m_nodes[succ]->pending)
+        continue;
+
+      if (m_abort)
+        finish(succ, ERT_CMD_STATE_ABORT);
+      else
+        release(succ);
+    }
+
+    if (--m_outstanding == 0) {
+      std::lock_guard<std::mutex> lk(m_mutex);
+      m_done.notify_all();
+    }
+  }
+
+  // Completion callback of a run object in the graph
+  void
+  notify(size_t idx, ert_cmd_state state)
+  {
+    if (!m_nodes[idx]->active.exchange(false))
+      return;
+
+    finish(idx, state);
+  }
+
+  void
+  throw_error() const
+  {
+    if (m_exception)
+      std::rethrow_exception(m_exception);
+
+    const auto& run = m_nodes[m_error_idx]->run;
+    auto epkt = run.get_ert_packet();
+    switch (epkt->opcode) {
+    case ERT_START_NPU:
+    case ERT_START_NPU_PREEMPT:
+    case ERT_START_NPU_PREEMPT_ELF:
+      throw xrt::runlist::aie_error(run, m_error_state, "rungraph failed execution");
+    default:
+      throw xrt::runlist::command_error(run, m_error_state, "rungraph failed execution");
+    }
+  }
+
+  void
+  clear_nodes()
+  {
+    for (auto& nd : m_nodes)
+      nd->run.get_handle()->pop_callback();
+  }
+
+public:
+  explicit
+  rungraph_impl(xrt::hw_context hwctx)
+    : m_hwctx{std::move(hwctx)}
+  {}
+
+  ~rungraph_impl()
+  {
+    try {
+      clear_nodes();
+    }
+    catch (const std::exception& ex) {
+      xrt_core::send_exception_message("rungraph clear_nodes error: " + std::string(ex.what()));
+    }
+  }
+
+  rungraph_impl(const rungraph_impl&) = delete;
+  rungraph_impl(rungraph_impl&&) = delete;
+  rungraph_impl& operator=(const rungraph_impl&) = delete;
+  rungraph_impl& operator=(rungraph_impl&&) = delete;
+
+  void
+  add(const xrt::run& run, const std::vector<xrt::run>& deps, std::vector<xrt::fence> fences)
+  {
+    if (m_state != state::idle)
+      throw xrt_core::error("rungraph must be idle before adding run objects");
+
+    auto run_impl = run.get_handle().get();
+    if (!run_impl)
+      throw xrt_core::error("cannot add uninitialized run object to rungraph");
+    if (m_index.count(run_impl))
+      throw xrt_core::error("run object is already part of the rungraph");
+
+    // Validate dependencies before changing any state
+    std::vector<size_t> depidx;
+    depidx.reserve(deps.size());
+    for (const auto& dep : deps) {
+      auto itr = m_index.find(dep.get_handle().get());
+      if (itr == m_index.end())
+        throw xrt_core::error("rungraph dependency must be added before its dependents");
+      if (std::find(depidx.begin(), depidx.end(), itr->second) == depidx.end())
+        depidx.push_back(itr->second);
+    }
+
+    auto idx = m_nodes.size();
+    m_nodes.push_back(std::make_unique<node>(run, std::move(fences)));
+
+    // Registering the callback makes the run a managed command.  The
+    // callback is removed again when the rungraph is reset or
+    // destructed.
+    try {
+      run_impl->add_callback([this, idx](ert_cmd_state state) { notify(idx, state); });
+    }
+    catch (...) {
+      m_nodes.pop_back();
+      throw;
+    }
+
+    for (auto dep : depidx)
+      m_nodes[dep]->successors.push_back(idx);
+    m_nodes[idx]->ndeps = depidx.size();
+    m_index.emplace(run_impl, idx);
+  }
+
+  void
+  execute()
+  {
+    if (m_state != state::idle)
+      throw xrt_core::error("rungraph must be idle before submitting for execution");
+
+    if (m_nodes.empty())
+      return;
+
+    for (auto& nd : m_nodes)
+      nd->pending = nd->ndeps;
+
+    m_error_state = ERT_CMD_STATE_COMPLETED;
+    m_exception = nullptr;
+    m_abort = false;
+    m_outstanding = m_nodes.size();
+    m_state = state::running;
+
+    // Start the roots.  Collect them first, a root may complete and
+    // release its successors before the loop has finished.
+    std::vector<size_t> roots;
+    for (size_t idx = 0; idx < m_nodes.size(); ++idx)
+      if (!m_nodes[idx]->ndeps)
+        roots.push_back(idx);
+
+    for (auto idx : roots) {
+      if (m_abort)
+        finish(idx, ERT_CMD_STATE_ABORT);
+      else
+        release(idx);
+    }
+  }
+
+  std::cv_status
+  wait_throw_on_error(const std::chrono::milliseconds& timeout)
+  {
+    if (m_state != state::running)
+      return std::cv_status::no_timeout;
+
+    {
+      std::unique_lock<std::mutex> lk(m_mutex);
+      auto done = [this] { return m_outstanding == 0; };
+      if (timeout.count() == 0)
+        m_done.wait(lk, done);
+      else if (!m_done.wait_for(lk, timeout, done))
+        return std::cv_status::timeout;
+    }
+
+    m_state = state::idle;
+    if (m_error_state != ERT_CMD_STATE_COMPLETED || m_exception)
+      throw_error();
+
+    return std::cv_status::no_timeout;
+  }
+
+  // The state of a finished graph is retained until the graph is
+  // executed again, such that a failed execution reads back as
+  // failed also after wait() has thrown the error.  A start failure
+  // is recorded as ERT_CMD_STATE_ABORT.
+  ert_cmd_state
+  get_ert_state()
+  {
+    if (m_state == state::running && m_outstanding)
+      return ERT_CMD_STATE_RUNNING;
+
+    // All nodes have finished, the graph is idle
+    m_state = state::idle;
+    std::lock_guard<std::mutex> lk(m_mutex);
+    return m_error_state;
+  }
+
+  void
+  reset()
+  {
+    if (m_state == state::running)
+      throw xrt_core::error("The rungraph is submitted for execution and cannot be reset. "
+                            "Please use wait() to ensure that all run objects have completed "
+                            "before calling reset().");
+
+    clear_nodes();
+    m_nodes.clear();
+    m_index.clear();
+    m_error_state = ERT_CMD_STATE_COMPLETED;
+    m_exception = nullptr;
+  }
+};
+
 // runlist::command_error_impl is in anticipation of additional
 // implementation data over that of run::command_error_impl
 class runlist::command_error_impl : public run::command_error_impl
@@ -3757,6 +4379,18 @@ get_cumask(const xrt::run& run)
   return run.get_handle()->get_cumask();
 }
 
+xrt::module
+get_module(const xrt::run& run)
+{
+  return run.get_handle()->get_module();
+}
+
+size_t
+get_chain_size(const xrt::runlist& runlist)
+{
+  return runlist.get_handle()->get_chain_size();
+}
+
 void
 set_cus(xrt::run& run, const std::bitset<max_cus>& mask)
 {
@@ -4112,6 +4746,12 @@ set_read_range(const xrt::kernel& kernel, uint32_t start, uint32_t size)
   ip->m_readrange = {start, size};
 }
 
+void
+set_run_wait_policy(const xrt::run& run, run_wait_policy policy)
+{
+  run.get_handle()->set_wait_policy(policy);
+}
+
 runlist::
 runlist(const xrt::hw_context& hwctx)
   : detail::pimpl<runlist_impl>(std::make_shared<runlist_impl>(hwctx))
@@ -4182,6 +4822,71 @@ reset()
   handle->reset();
 }
 
+
+////////////////////////////////////////////////////////////////
+// xrt::rungraph
+////////////////////////////////////////////////////////////////
+rungraph::
+rungraph(const xrt::hw_context& hwctx)
+  : detail::pimpl<rungraph_impl>(std::make_shared<rungraph_impl>(hwctx))
+{}
+
+rungraph::
+~rungraph()
+{
+  // For interception
+}
+
+void
+rungraph::
+add(const xrt::run& run, const std::vector<xrt::run>& deps)
+{
+  if (!handle)
+    throw xrt_core::error("cannot add run object to uninitialized rungraph");
+
+  handle->add(run, deps, {});
+}
+
+void
+rungraph::
+add(const xrt::run& run, const std::vector<xrt::run>& deps, const std::vector<xrt::fence>& fences)
+{
+  if (!handle)
+    throw xrt_core::error("cannot add run object to uninitialized rungraph");
+
+  handle->add(run, deps, fences);
+}
+
+void
+rungraph::
+execute()
+{
+  XRT_TRACE_POINT_SCOPE(xrt_rungraph_execute);
+  handle->execute();
+}
+
+std::cv_status
+rungraph::
+wait(const std::chrono::milliseconds& timeout) const
+{
+  XRT_TRACE_POINT_SCOPE(xrt_rungraph_wait);
+  return handle->wait_throw_on_error(timeout);
+}
+
+ert_cmd_state
+rungraph::
+state() const
+{
+  return handle->get_ert_state();
+}
+
+void
+rungraph::
+reset()
+{
+  handle->reset();
+}
+
 } // namespace xrt
 
 ////////////////////////////////////////////////////////////////
@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2023-2026 Advanced Micro Devices, Inc. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 #define XCL_DRIVER_DLL_EXPORT  // exporting xrt_module.h
 #define XRT_API_SOURCE         // exporting xrt_module.h
@@ -130,6 +130,58 @@ using instr_buf = buf;
 using control_packet = buf;
 using ctrlcode = buf; // represent control code for column or partition
 
+// class sync_ranges - byte ranges of a buffer object pending sync
+//
+// After the first run, patching modifies a few words per patch site
+// of otherwise unchanged control code.  Patched ranges are recorded
+// and synced to device once before the next run, with overlapping
+// and nearby ranges merged to minimize the number of sync calls.
+class sync_ranges
+{
+  // Ranges separated by less than this many bytes are merged, syncing
+  // the unmodified bytes in between is cheaper than a separate sync
+  static constexpr size_t merge_gap = 64;
+
+  std::vector<std::pair<size_t, size_t>> m_ranges; // offset, size
+
+public:
+  void
+  add(size_t offset, size_t size)
+  {
+    m_ranges.emplace_back(offset, size);
+  }
+
+  void
+  clear()
+  {
+    m_ranges.clear();
+  }
+
+  // Sync recorded ranges of bo to device.  Returns number of syncs
+  size_t
+  sync(xrt::bo& bo)
+  {
+    if (m_ranges.empty())
+      return 0;
+
+    std::sort(m_ranges.begin(), m_ranges.end());
+    size_t syncs = 0;
+    size_t offset = m_ranges.front().first;
+    size_t end = offset;
+    for (const auto& [roffset, rsize] : m_ranges) {
+      if (roffset > end + merge_gap) {
+        bo.sync(XCL_BO_SYNC_BO_TO_DEVICE, end - offset, offset);
+        ++syncs;
+        offset = roffset;
+      }
+      end = std::max(end, roffset + rsize);
+    }
+    bo.sync(XCL_BO_SYNC_BO_TO_DEVICE, end - offset, offset);
+    m_ranges.clear();
+    return ++syncs;
+  }
+};
+
 // struct patcher - patcher for a symbol
 //
 // Manage patching of a symbol in the control code.  The symbol
@@ -282,23 +334,14 @@ private:
     bd_data_ptr[2] = (bd_data_ptr[2] & 0xFFFF0000) | (base_address >> 32);            // NOLINT
   }
 
-  template<typename T>
+  // Patch all patch sites in buffer at base.  If dirty is not null,
+  // the patched ranges of the buffer are recorded for a later sync.
+  // A null dirty implies that the caller syncs the entire buffer, this
+  // is the case for first time patching and for shim tests that call
+  // this function with a host address directly.
   void
-  patch_it_impl(T base_or_bo, uint64_t new_value, bool first)
+  patch_it_impl(uint8_t* base, uint64_t new_value, sync_ranges* dirty)
   {
-    // base_or_bo is either a pointer to base address of buffer to be patched
-    // or xrt::bo object itself
-    // shim tests call this function with address directly and call sync themselves
-    // but when xrt::bo is passed, we need to call sync explictly only if its not the
-    // first time patching, as in first time patching entire bo is synced
-    uint8_t* base = nullptr;
-
-    if constexpr (std::is_same_v<T, xrt::bo>) {
-      base = reinterpret_cast<uint8_t*>(base_or_bo.map());
-    }
-    else
-      base = base_or_bo;
-
     for (auto& item : m_ctrlcode_patchinfo) {
       auto offset = item.offset_to_patch_buffer;
       auto bd_data_ptr = reinterpret_cast<uint32_t*>(base + offset);
@@ -313,76 +356,60 @@ private:
         std::copy(item.bd_data_ptrs, item.bd_data_ptrs + max_bd_words, bd_data_ptr);
       }
 
-      // lambda for calling sync bo if template arg is of type xrt::bo
-      // We only sync the words that are patched not the entire bo
+      // record the words that are patched for sync of partial bo
       auto sync = [&](size_t size) {
-        if constexpr (std::is_same_v<T, xrt::bo>) {
-          base_or_bo.sync(XCL_BO_SYNC_BO_TO_DEVICE, size, offset);
-        }
+        if (dirty)
+          dirty->add(offset, size);
       };
 
       switch (m_symbol_type) {
       case symbol_type::address_64:
         // new_value is a 64bit address
         patch64(bd_data_ptr, new_value);
-        if (!first) {
-          // sync 64 bits patched
-          sync(sizeof(uint64_t));
-        }
+        // sync 64 bits patched
+        sync(sizeof(uint64_t));
         break;
       case symbol_type::scalar_32bit_kind:
         // new_value is a register value
         if (item.mask) {
           patch32(bd_data_ptr, new_value, item.mask);
-          if (!first) {
-            // sync 32 bits patched
-            sync(sizeof(uint32_t));
-          }
+          // sync 32 bits patched
+          sync(sizeof(uint32_t));
         }
         break;
       case symbol_type::shim_dma_base_addr_symbol_kind:
         // new_value is a bo address
         patch57(bd_data_ptr, new_value + item.offset_to_base_bo_addr);
-        if (!first) {
-          // Data in this case is written to 8th offset of bd_data_ptr
-          // so sync all the words (max_bd_words)
-          sync(sizeof(uint32_t) * max_bd_words);
-        }
+        // Data in this case is written to 8th offset of bd_data_ptr
+        // so sync all the words (max_bd_words)
+        sync(sizeof(uint32_t) * max_bd_words);
         break;
       case symbol_type::shim_dma_aie4_base_addr_symbol_kind:
         // new_value is a bo address
         patch57_aie4(bd_data_ptr, new_value + item.offset_to_base_bo_addr);
-        if (!first) {
-          // sync 64 bits or 2 words
-          sync(sizeof(uint64_t));
-        }
+        // sync 64 bits or 2 words
+        sync(sizeof(uint64_t));
         break;
       case symbol_type::control_packet_57:
         // new_value is a bo address
         patch_ctrl57(bd_data_ptr, new_value + item.offset_to_base_bo_addr);
-        if (!first) {
-          // Data in this case is written till 3rd offset of bd_data_ptr
-          // so syncing 4 words
-          sync(4 * sizeof(uint32_t));    // NOLINT
-        }
+        // Data in this case is written till 3rd offset of bd_data_ptr
+        // so syncing 4 words
+        sync(4 * sizeof(uint32_t));    // NOLINT
         break;
       case symbol_type::control_packet_48:
         // new_value is a bo address
         patch_ctrl48(bd_data_ptr, new_value + item.offset_to_base_bo_addr);
-        if (!first) {
-          // Data in this case is written till 3rd offset of bd_data_ptr
-          // so syncing 4 words
-          sync(4 * sizeof(uint32_t));    // NOLINT
-        }
+        // Data in this case is written till 3rd offset of bd_data_ptr
+        // so syncing 4 words
+        sync(4 * sizeof(uint32_t));    // NOLINT
         break;
       case symbol_type::shim_dma_48:
         // new_value is a bo address
         patch_shim48(bd_data_ptr, new_value + item.offset_to_base_bo_addr);
-        if (!first) {
-          // Data in this case is written till 2nd offset of bd_data_ptr
-          // so syncing 3 words
-          sync(3 * sizeof(uint32_t));    // NOLINT
-        }
+        // Data in this case is written till 2nd offset of bd_data_ptr
+        // so syncing 3 words
+        sync(3 * sizeof(uint32_t));    // NOLINT
         break;
       default:
         throw std::runtime_error("Unsupported symbol type");
@@ -392,18 +419,18 @@ private:
 
 public:
   void
-  patch_it(uint8_t* base, uint64_t value, bool)
+  patch_it(uint8_t* base, uint64_t value, sync_ranges*)
   {
     // this function is used by internal shim level tests
     // which does explicit sync of buffers
     // so needn't do a partial sync
-    patch_it_impl(base, value, true /*no partial sync*/);
+    patch_it_impl(base, value, nullptr /*no partial sync*/);
   }
 
   void
-  patch_it(xrt::bo bo, uint64_t value, bool first)
+  patch_it(xrt::bo bo, uint64_t value, sync_ranges* dirty)
   {
-    patch_it_impl(bo, value, first);
+    patch_it_impl(bo.map<uint8_t*>(), value, dirty);
   }
 };
 
@@ -668,11 +695,27 @@ public:
   // @param patch - patch value
   // @param buf_type - whether it is control-code, control-packet, preempt-save or preempt-restore
   // @param grp_index - grp index to identify the ctrlcode that is being patched
-  // @param first - boolean indicating if its first time patching
+  // @param dirty - ranges of bo to sync after patching, nullptr if entire bo is synced
   // @Return true if symbol was patched, false otherwise
   virtual bool
   patch_it(xrt::bo, const std::string&, size_t, uint64_t, xrt_core::patcher::buf_type,
-           uint32_t, bool)
+           uint32_t, sync_ranges*)
+  {
+    throw std::runtime_error("Not supported");
+  }
+
+  // Get the patcher of an argument in control code
+  //
+  // @param symbol - symbol name
+  // @param index - argument index
+  // @param buf_type - buffer type to get patcher for
+  // @param grp_index - grp index to identify the ctrlcode
+  // @Return patcher for argument, or nullptr if argument is not patched
+  //
+  // The returned patcher is owned by this module and can be used to
+  // patch the argument repeatedly without symbol lookup.
+  virtual patcher*
+  get_arg_patcher(const std::string&, size_t, xrt_core::patcher::buf_type, uint32_t)
   {
     throw std::runtime_error("Not supported");
   }
@@ -925,43 +968,48 @@ class module_elf : public module_impl
         + std::to_string(sym_index));
   }
 
-  template <typename T>
-  bool
-  patch_it_impl(T base, const std::string& argnm, size_t index, uint64_t patch,
-                xrt_core::patcher::buf_type type, uint32_t grp_index, bool first)
+  // Find patcher for argument by name, or by index if no patcher
+  // for the argument name
+  patcher*
+  find_patcher(const std::string& argnm, size_t index, xrt_core::patcher::buf_type type,
+               uint32_t grp_index)
   {
-    const auto key_string = generate_key_string(argnm, type);
-    // check if arg patcher exists for this ctrl code 
-    if (m_arg2patcher.find(grp_index) == m_arg2patcher.end())
-      return false; // no patch entries for given grp idx
+    // check if arg patcher exists for this ctrl code
+    auto grp = m_arg2patcher.find(grp_index);
+    if (grp == m_arg2patcher.end())
+      return nullptr; // no patch entries for given grp idx
 
-    auto it = m_arg2patcher[grp_index].find(key_string);
-    auto not_found_use_argument_name = (it == m_arg2patcher[grp_index].end());
+    auto it = grp->second.find(generate_key_string(argnm, type));
+    auto not_found_use_argument_name = (it == grp->second.end());
     if (not_found_use_argument_name) {// Search using index
-      auto index_string = std::to_string(index);
-      const auto key_index_string = generate_key_string(index_string, type);
-      it = m_arg2patcher[grp_index].find(key_index_string);
-      if (it == m_arg2patcher[grp_index].end())
-        return false;
+      it = grp->second.find(generate_key_string(std::to_string(index), type));
+      if (it == grp->second.end())
+        return nullptr;
     }
 
-    it->second.patch_it(base, patch, first);
     if (xrt_core::config::get_xrt_debug()) {
-      if (not_found_use_argument_name) {
-        std::stringstream ss;
-        ss << "Patched " << patcher::to_string(type)
-           << " using argument index " << index
-           << " with value " << std::hex << patch;
-        xrt_core::message::send( xrt_core::message::severity_level::debug, "xrt_module", ss.str());
-      }
-      else {
-        std::stringstream ss;
-        ss << "Patched " << patcher::to_string(type)
-           << " using argument name " << argnm
-           << " with value " << std::hex << patch;
-        xrt_core::message::send( xrt_core::message::severity_level::debug, "xrt_module", ss.str());
-      }
+      std::stringstream ss;
+      ss << "Patching " << patcher::to_string(type);
+      if (not_found_use_argument_name)
+        ss << " using argument index " << index;
+      else
+        ss << " using argument name " << argnm;
+      xrt_core::message::send( xrt_core::message::severity_level::debug, "xrt_module", ss.str());
     }
+
+    return &it->second;
+  }
+
+  template <typename T>
+  bool
+  patch_it_impl(T base, const std::string& argnm, size_t index, uint64_t patch,
+                xrt_core::patcher::buf_type type, uint32_t grp_index, sync_ranges* dirty)
+  {
+    auto patcher = find_patcher(argnm, index, type, grp_index);
+    if (!patcher)
+      return false;
+
+    patcher->patch_it(base, patch, dirty);
     return true;
   }
 
@@ -1089,16 +1137,23 @@ public:
 
   bool
   patch_it(uint8_t* base, const std::string& argnm, size_t index, uint64_t patch,
-           xrt_core::patcher::buf_type type, uint32_t grp_index, bool first) override
+           xrt_core::patcher::buf_type type, uint32_t grp_index, bool) override
   {
-    return patch_it_impl(base, argnm, index, patch, type, grp_index, first);
+    return patch_it_impl(base, argnm, index, patch, type, grp_index, nullptr);
   }
 
   bool
   patch_it(xrt::bo bo, const std::string& argnm, size_t index, uint64_t patch,
-           xrt_core::patcher::buf_type type, uint32_t grp_index, bool first) override
+           xrt_core::patcher::buf_type type, uint32_t grp_index, sync_ranges* dirty) override
   {
-    return patch_it_impl(bo, argnm, index, patch, type, grp_index, first);
+    return patch_it_impl(bo, argnm, index, patch, type, grp_index, dirty);
+  }
+
+  patcher*
+  get_arg_patcher(const std::string& argnm, size_t index, xrt_core::patcher::buf_type type,
+                  uint32_t grp_index) override
+  {
+    return find_patcher(argnm, index, type, grp_index);
   }
 
   uint8_t
@@ -1918,6 +1973,27 @@ class module_sram : public module_impl
   // this variable tells if its first time patching
   bool m_first_patch = true;
 
+  // Ranges of buffer objects patched since last sync, synced once
+  // prior to next run.  Only used after first time patching.
+  std::vector<std::pair<xrt::bo, sync_ranges>> m_sync_ranges;
+
+  // Number of partial syncs of patched ranges
+  size_t m_patch_syncs = 0;
+
+  // Patchers of a kernel argument resolved from parent module on
+  // first patch of the argument.  Re-patching the argument in
+  // subsequent runs is an indexed lookup without symbol search.
+  struct arg_patchers
+  {
+    bool resolved = false;
+    patcher* ctrltext = nullptr; // instruction buffer (aie2p) or control code (aie2ps)
+    patcher* ctrldata = nullptr; // control packet (aie2p)
+    patcher* pad = nullptr;      // scratchpad / control packet (aie2ps)
+  };
+
+  // Indexed by argument index
+  std::vector<arg_patchers> m_arg_patchers;
+
   // In platforms that support Dynamic tracing xrt bo's are
   // created and passed to driver/firmware to hold tracing output
   // written by it.
@@ -2201,43 +2277,102 @@ class module_sram : public module_impl
     patch_instr_value(bo_ctrlcode, argnm, index, bo.address(), type, grp_idx);
   }
 
+  // Get the ranges to record patching of bo in, nullptr if first
+  // time patching in which case the entire bo is synced
+  sync_ranges*
+  get_sync_ranges(const xrt::bo& bo)
+  {
+    if (m_first_patch)
+      return nullptr;
+
+    auto itr = std::find_if(m_sync_ranges.begin(), m_sync_ranges.end(),
+                            [&bo](const auto& entry) { return entry.first.get_handle() == bo.get_handle(); });
+    if (itr != m_sync_ranges.end())
+      return &itr->second;
+
+    return &m_sync_ranges.emplace_back(bo, sync_ranges{}).second;
+  }
+
+  // Sync patched ranges of all buffers
+  void
+  sync_patched_ranges()
+  {
+    for (auto& [bo, ranges] : m_sync_ranges)
+      m_patch_syncs += ranges.sync(bo);
+  }
+
+  arg_patchers
+  resolve_arg_patchers(const std::string& argnm, size_t index)
+  {
+    arg_patchers ap;
+    ap.resolved = true;
+    if (m_parent->get_os_abi() == Elf_Amd_Aie2p) {
+      if (m_ctrlpkt_bo)
+        ap.ctrldata = m_parent->get_arg_patcher(argnm, index, xrt_core::patcher::buf_type::ctrldata, m_ctrl_code_id);
+      ap.ctrltext = m_parent->get_arg_patcher(argnm, index, xrt_core::patcher::buf_type::ctrltext, m_ctrl_code_id);
+    }
+    else {
+      ap.ctrltext = m_parent->get_arg_patcher(argnm, index, xrt_core::patcher::buf_type::ctrltext, m_ctrl_code_id);
+      ap.pad = m_parent->get_arg_patcher(argnm, index, xrt_core::patcher::buf_type::pad, m_ctrl_code_id);
+    }
+    return ap;
+  }
+
+  // Get patchers for argument, resolved on first use of argument index.
+  // The argument name for an index is fixed for the kernel of this module.
+  const arg_patchers&
+  get_arg_patchers(const std::string& argnm, size_t index)
+  {
+    if (index >= m_arg_patchers.size())
+      m_arg_patchers.resize(index + 1);
+
+    auto& ap = m_arg_patchers[index];
+    if (!ap.resolved) {
+      ap = resolve_arg_patchers(argnm, index);
+      if (ap.ctrltext || ap.ctrldata || ap.pad)
+        m_patched_args.insert(argnm);
+    }
+
+    return ap;
+  }
+
   void
   patch_value(const std::string& argnm, size_t index, uint64_t value)
   {
+    const auto& ap = get_arg_patchers(argnm, index);
     bool patched = false;
     if (m_parent->get_os_abi() == Elf_Amd_Aie2p) {
       // patch control-packet buffer
-      if (m_ctrlpkt_bo) {
-        if (m_parent->patch_it(m_ctrlpkt_bo, argnm, index, value, xrt_core::patcher::buf_type::ctrldata,
-                               m_ctrl_code_id, m_first_patch))
-          patched = true;
+      if (ap.ctrldata) {
+        ap.ctrldata->patch_it(m_ctrlpkt_bo, value, get_sync_ranges(m_ctrlpkt_bo));
+        patched = true;
       }
       // patch instruction buffer
-      if (m_parent->patch_it(m_instr_bo, argnm, index, value, xrt_core::patcher::buf_type::ctrltext,
-                             m_ctrl_code_id, m_first_patch))
-          patched = true;
+      if (ap.ctrltext) {
+        ap.ctrltext->patch_it(m_instr_bo, value, get_sync_ranges(m_instr_bo));
+        patched = true;
+      }
     }
     else {
-      if (m_parent->patch_it(m_buffer, argnm, index, value, xrt_core::patcher::buf_type::ctrltext,
-                             m_ctrl_code_id, m_first_patch))
+      if (ap.ctrltext) {
+        ap.ctrltext->patch_it(m_buffer, value, get_sync_ranges(m_buffer));
         patched = true;
-
-      if (m_parent->patch_it(m_buffer, argnm, index, value, xrt_core::patcher::buf_type::pad,
-                             m_ctrl_code_id, m_first_patch))
-          patched = true;
+      }
+      if (ap.pad) {
+        ap.pad->patch_it(m_buffer, value, get_sync_ranges(m_buffer));
+        patched = true;
+      }
     }
 
-    if (patched) {
-      m_patched_args.insert(argnm);
+    if (patched)
       m_dirty = true;
-    }
   }
 
   bool
   patch_instr_value(xrt::bo& bo, const std::string& argnm, size_t index, uint64_t value,
                     xrt_core::patcher::buf_type type, uint32_t grp_idx)
   {
-    if (!m_parent->patch_it(bo, argnm, index, value, type, grp_idx, m_first_patch))
+    if (!m_parent->patch_it(bo, argnm, index, value, type, grp_idx, get_sync_ranges(bo)))
       return false;
 
     m_dirty = true;
@@ -2341,6 +2476,10 @@ class module_sram : public module_impl
       }
     }
 
+    // For subsequent runs only the patched ranges are synced
+    if (!m_first_patch)
+      sync_patched_ranges();
+
     m_dirty = false;
     m_first_patch = false;
   }
@@ -2674,6 +2813,12 @@ public:
     m_ctrl_scratch_pad_mem.sync(XCL_BO_SYNC_BO_FROM_DEVICE);
     return m_ctrl_scratch_pad_mem;
   }
+
+  size_t
+  get_patch_sync_count() const
+  {
+    return m_patch_syncs;
+  }
 };
 
 } // namespace xrt
@@ -2824,6 +2969,16 @@ sync(const xrt::module& module)
   module.get_handle()->sync_if_dirty();
 }
 
+size_t
+get_patch_sync_count(const xrt::module& module)
+{
+  auto module_sram = std::dynamic_pointer_cast<xrt::module_sram>(module.get_handle());
+  if (!module_sram)
+    throw std::runtime_error("Getting module_sram failed, wrong module object passed\n");
+
+  return module_sram->get_patch_sync_count();
+}
+
 enum ert_cmd_opcode
 get_ert_opcode(const xrt::module& module)
 {
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2020-2022 Xilinx, Inc. All rights reserved.
-// Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2023-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 // This file implements XRT xclbin APIs as declared in
 // core/include/experimental/xrt_xclbin.h
@@ -9,10 +9,12 @@
 #include "core/include/xrt/experimental/xrt_xclbin.h"
 
 #include "core/common/system.h"
+#include "core/common/config_reader.h"
 #include "core/common/device.h"
 #include "core/common/message.h"
 #include "core/common/module_loader.h"
 #include "core/common/query_requests.h"
+#include "core/common/utils.h"
 #include "core/common/xclbin_parser.h"
 #include "core/common/xclbin_swemu.h"
 
@@ -25,11 +27,15 @@
 #include <boost/algorithm/string.hpp>
 
 #include <array>
+#include <cstddef>
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <numeric>
 #include <regex>
 #include <set>
+#include <sstream>
+#include <unordered_map>
 #include <vector>
 #include <mutex>
 
@@ -38,6 +44,10 @@
 # pragma warning( disable : 4244 4267 4996)
 #else
 # include <linux/uuid.h>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
 #endif
 
 namespace {
@@ -90,6 +100,86 @@ read_xclbin(const std::string& fnm)
   return read_file(path.string());
 }
 
+// class mapped_file - Read only memory mapping of a file
+//
+// Pages are loaded on first access.  The mapping is read only, there
+// is no copy on write, and the data must not be modified through it;
+// a write faults.  On Windows the file is read into memory.
+class mapped_file
+{
+#ifdef _WIN32
+  std::vector<char> m_data;
+#else
+  void* m_addr = nullptr;
+#endif
+  size_t m_size = 0;
+
+public:
+  explicit
+  mapped_file(const std::string& fnm)
+#ifdef _WIN32
+    : m_data(read_file(fnm))
+    , m_size(m_data.size())
+  {}
+#else
+  {
+    auto fd = open(fnm.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+      throw std::runtime_error("Failed to open file '" + fnm + "' for reading");
+
+    struct stat sb {};
+    if (fstat(fd, &sb) != 0 || sb.st_size == 0) {
+      close(fd);
+      throw std::runtime_error("Failed to stat file '" + fnm + "'");
+    }
+
+    m_size = static_cast<size_t>(sb.st_size);
+    m_addr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // mapping holds a reference to the file
+    if (m_addr == MAP_FAILED)
+      throw std::runtime_error("Failed to map file '" + fnm + "'");
+  }
+#endif
+
+  ~mapped_file()
+  {
+#ifndef _WIN32
+    munmap(m_addr, m_size);
+#endif
+  }
+
+  mapped_file(const mapped_file&) = delete;
+  mapped_file(mapped_file&&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+  mapped_file& operator=(mapped_file&&) = delete;
+
+  const char*
+  data() const
+  {
+#ifdef _WIN32
+    return m_data.data();
+#else
+    return static_cast<const char*>(m_addr);
+#endif
+  }
+
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+};
+
+static std::unique_ptr<mapped_file>
+map_xclbin(const std::string& fnm)
+{
+  if (fnm.empty())
+    throw std::runtime_error("No xclbin specified");
+
+  auto path = xrt_core::environment::platform_path(fnm);
+  return std::make_unique<mapped_file>(path.string());
+}
+
 static std::vector<char>
 copy_axlf(const axlf* top)
 {
@@ -752,39 +842,45 @@ public:
 // class xclbin_full - Implementation of full xclbin
 //
 // A full xclbin is constructed from a file on disk or from a complete
-// binary images for file content
+// binary images for file content.  A file on disk is either read into
+// memory or memory mapped read only (Runtime.xclbin_mmap).  Either way
+// sections are referenced in place within the raw data, which is never
+// modified.
 class xclbin_full : public xclbin_impl
 {
   std::vector<char> m_axlf;    // complete copy of xclbin raw data
+  std::unique_ptr<mapped_file> m_mapping; // or mapping of xclbin file
   const axlf* m_top = nullptr; // axlf pointer to the raw data
   uuid m_uuid;                 // uuid of xclbin
   uuid m_intf_uuid;
 
-  // sections within this xclbin
-  std::multimap<axlf_section_kind, std::vector<char>> m_axlf_sections;
+  // sections within this xclbin, pointers into raw data
+  std::multimap<axlf_section_kind, std::pair<const char*, size_t>> m_axlf_sections;
 
   void
-  emplace_section(const axlf_section_header* hdr, axlf_section_kind kind)
+  emplace_section(const axlf_section_header* hdr, axlf_section_kind kind, size_t size)
   {
+    if (hdr->m_sectionOffset > size || hdr->m_sectionSize > size - hdr->m_sectionOffset)
+      throw std::runtime_error("Invalid xclbin, section exceeds xclbin size");
+
     auto section_data = reinterpret_cast<const char*>(m_top) + hdr->m_sectionOffset;
-    std::vector<char> data{section_data, section_data + hdr->m_sectionSize};
-    m_axlf_sections.emplace(kind , std::move(data));
+    m_axlf_sections.emplace(kind, std::make_pair(section_data, static_cast<size_t>(hdr->m_sectionSize)));
   }
 
   void
-  emplace_soft_kernel_sections(const axlf_section_header* hdr)
+  emplace_soft_kernel_sections(const axlf_section_header* hdr, size_t size)
   {
     while (hdr != nullptr) {
-      emplace_section(hdr, SOFT_KERNEL);
+      emplace_section(hdr, SOFT_KERNEL, size);
       hdr = ::xclbin::get_axlf_section_next(m_top, hdr, SOFT_KERNEL);
     }
   }
 
   void
-  init_axlf()
+  init_axlf(const char* data, size_t size)
   {
-    const axlf* tmp = reinterpret_cast<const axlf*>(m_axlf.data());
-    if (strncmp(tmp->m_magic, "xclbin2", strlen("xclbin2")) != 0) // Future: Do not hardcode "xclbin2"
+    const axlf* tmp = reinterpret_cast<const axlf*>(data);
+    if (size < sizeof(axlf) || strncmp(tmp->m_magic, "xclbin2", strlen("xclbin2")) != 0) // Future: Do not hardcode "xclbin2"
       throw std::runtime_error("Invalid xclbin");
     m_top = tmp;
 
@@ -799,23 +895,30 @@ class xclbin_full : public xclbin_impl
 
       // account for multiple soft_kernel sections
       if (kind == SOFT_KERNEL)
-        emplace_soft_kernel_sections(hdr);
+        emplace_soft_kernel_sections(hdr, size);
       else
-        emplace_section(hdr, kind);
+        emplace_section(hdr, kind, size);
     }
   }
 
   void
   init()
   {
-    init_axlf();
+    if (m_mapping)
+      init_axlf(m_mapping->data(), m_mapping->size());
+    else
+      init_axlf(m_axlf.data(), m_axlf.size());
   }
 
 public:
   explicit
   xclbin_full(const std::string& filename)
-    : m_axlf(read_xclbin(filename))
   {
+    if (xrt_core::config::get_xclbin_mmap())
+      m_mapping = map_xclbin(filename);
+    else
+      m_axlf = read_xclbin(filename);
+
     init();
   }
 
@@ -833,6 +936,11 @@ public:
     init();
   }
 
+  xclbin_full(const xclbin_full&) = delete;
+  xclbin_full(xclbin_full&&) = delete;
+  xclbin_full& operator=(const xclbin_full&) = delete;
+  xclbin_full& operator=(xclbin_full&&) = delete;
+
   uuid
   get_uuid() const override
   {
@@ -875,7 +983,7 @@ public:
   {
     auto itr = m_axlf_sections.find(kind);
     return itr != m_axlf_sections.end()
-      ? std::make_pair((*itr).second.data(), (*itr).second.size())
+      ? (*itr).second
       : std::make_pair(nullptr, size_t(0));
   }
 
@@ -890,7 +998,7 @@ public:
       std::vector<std::pair<const char*, size_t>> return_sections;
 
       for (auto itr = result.first; itr != result.second; itr++)
-        return_sections.emplace_back(std::make_pair(itr->second.data(), itr->second.size()));
+        return_sections.emplace_back(itr->second);
 
       return return_sections;
     }
@@ -944,6 +1052,237 @@ public:
   }
 };
 
+// class xclbin_repository_index - index of xclbin files in repository
+//
+// The index records uuid and kernel names of each xclbin file in a
+// repository along with file size and modification time.  Index
+// entries are created by reading only the axlf header, the section
+// table, and the IP_LAYOUT section of an xclbin.
+//
+// The index is persisted in a per repository cache file and entries
+// are revalidated against file size and modification time when the
+// index is built, such that only new or changed xclbin files are read.
+class xclbin_repository_index
+{
+  struct entry
+  {
+    std::string path;
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    std::string uuid;
+    std::vector<std::string> kernels;
+  };
+
+  static constexpr const char* cache_magic = "xrt-xclbin-index 1";
+
+  std::vector<entry> m_entries;
+  std::unordered_map<std::string, size_t> m_by_uuid;               // uuid -> entry
+  std::unordered_multimap<std::string, size_t> m_by_kernel;        // kernel -> entry
+
+  static int64_t
+  get_mtime(const std::filesystem::path& path)
+  {
+    return static_cast<int64_t>(std::filesystem::last_write_time(path).time_since_epoch().count());
+  }
+
+  // Read header, section table, and ip layout of xclbin.  Returns
+  // false if the file is not a valid xclbin.
+  static bool
+  read_entry(entry& e)
+  {
+    std::ifstream stream(e.path, std::ios::binary);
+    axlf top {};
+    if (!stream.read(reinterpret_cast<char*>(&top), sizeof(axlf)))
+      return false;
+    if (strncmp(top.m_magic, "xclbin2", strlen("xclbin2")) != 0)
+      return false;
+
+    e.uuid = uuid(top.m_header.uuid).to_string();
+
+    auto nsections = top.m_header.m_numSections;
+    if (nsections == 0 || nsections > 1024)
+      return true;
+    std::vector<axlf_section_header> sections(nsections);
+    stream.seekg(offsetof(axlf, m_sections));
+    if (!stream.read(reinterpret_cast<char*>(sections.data()), nsections * sizeof(axlf_section_header)))
+      return true;
+
+    auto itr = std::find_if(sections.begin(), sections.end(),
+                            [](const auto& hdr) { return hdr.m_sectionKind == IP_LAYOUT; });
+    if (itr == sections.end() || itr->m_sectionSize < sizeof(ip_layout)
+        || itr->m_sectionOffset > e.size || itr->m_sectionSize > e.size - itr->m_sectionOffset)
+      return true;
+
+    std::vector<char> data(itr->m_sectionSize);
+    stream.seekg(static_cast<std::streamoff>(itr->m_sectionOffset));
+    if (!stream.read(data.data(), static_cast<std::streamsize>(data.size())))
+      return true;
+
+    auto layout = reinterpret_cast<const ip_layout*>(data.data());
+    auto count = std::min<size_t>(layout->m_count, (data.size() - offsetof(ip_layout, m_ip_data)) / sizeof(ip_data));
+    std::set<std::string> kernels;
+    for (size_t idx = 0; idx < count; ++idx) {
+      const auto& ip = layout->m_ip_data[idx];
+      if (ip.m_type != IP_KERNEL && ip.m_type != IP_PS_KERNEL)
+        continue;
+
+      // ip name is "kernel:instance"
+      std::string name(reinterpret_cast<const char*>(ip.m_name), strnlen(reinterpret_cast<const char*>(ip.m_name), sizeof(ip.m_name)));
+      kernels.insert(name.substr(0, name.find(':')));
+    }
+    e.kernels.assign(kernels.begin(), kernels.end());
+    return true;
+  }
+
+  static std::filesystem::path
+  get_cache_path(const std::vector<std::filesystem::path>& dirs)
+  {
+    if (!xrt_core::config::get_xclbin_repository_cache())
+      return {};
+
+    std::filesystem::path cache_dir;
+    if (auto xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg)
+      cache_dir = xdg;
+    else if (auto home = std::getenv("HOME"); home && *home)
+      cache_dir = std::filesystem::path(home) / ".cache";
+    else
+      return {};
+
+    std::string key;
+    for (const auto& dir : dirs)
+      key.append(std::filesystem::absolute(dir).string()).append(1, '\n');
+
+    std::stringstream fnm;
+    fnm << "xclbin_repository_" << std::hex << std::hash<std::string>{}(key) << ".index";
+    return cache_dir / "xrt" / fnm.str();
+  }
+
+  static std::unordered_map<std::string, entry>
+  read_cache(const std::filesystem::path& cache)
+  {
+    std::unordered_map<std::string, entry> entries;
+    std::ifstream stream(cache);
+    std::string line;
+    if (!std::getline(stream, line) || line != cache_magic)
+      return entries;
+
+    // path \t size \t mtime \t uuid \t kernel,kernel,...
+    while (std::getline(stream, line)) {
+      std::vector<std::string> fields;
+      boost::split(fields, line, boost::is_any_of("\t"));
+      if (fields.size() != 5)
+        continue;
+
+      try {
+        entry e;
+        e.path = fields[0];
+        e.size = std::stoull(fields[1]);
+        e.mtime = std::stoll(fields[2]);
+        e.uuid = fields[3];
+        if (!fields[4].empty())
+          boost::split(e.kernels, fields[4], boost::is_any_of(","));
+        entries.emplace(e.path, std::move(e));
+      }
+      catch (const std::exception&) {
+        // ignore malformed line
+      }
+    }
+    return entries;
+  }
+
+  void
+  write_cache(const std::filesystem::path& cache) const
+  {
+    namespace sfs = std::filesystem;
+    std::error_code ec;
+    sfs::create_directories(cache.parent_path(), ec);
+
+    // write to temporary file and rename such that concurrent
+    // readers never observe a partial index
+    auto tmp = cache;
+    tmp += "." + std::to_string(xrt_core::utils::get_pid());
+    {
+      std::ofstream stream(tmp);
+      if (!stream)
+        return;
+
+      stream << cache_magic << '\n';
+      for (const auto& e : m_entries) {
+        if (e.path.find_first_of("\t\n") != std::string::npos)
+          continue;
+        stream << e.path << '\t' << e.size << '\t' << e.mtime << '\t' << e.uuid << '\t'
+               << boost::join(e.kernels, ",") << '\n';
+      }
+      if (!stream)
+        return;
+    }
+
+    sfs::rename(tmp, cache, ec);
+    if (ec)
+      sfs::remove(tmp, ec);
+  }
+
+public:
+  xclbin_repository_index(const std::vector<std::filesystem::path>& dirs,
+                          const std::vector<std::filesystem::path>& xclbin_paths)
+  {
+    auto cache = get_cache_path(dirs);
+    auto cached = cache.empty()
+      ? std::unordered_map<std::string, entry>{}
+      : read_cache(cache);
+
+    bool dirty = cached.size() != xclbin_paths.size();
+    for (const auto& path : xclbin_paths) {
+      entry e;
+      e.path = path.string();
+      std::error_code ec;
+      e.size = std::filesystem::file_size(path, ec);
+      if (ec)
+        continue;
+      e.mtime = get_mtime(path);
+
+      auto itr = cached.find(e.path);
+      if (itr != cached.end() && itr->second.size == e.size && itr->second.mtime == e.mtime) {
+        m_entries.push_back(std::move(itr->second));
+        continue;
+      }
+
+      dirty = true;
+      if (read_entry(e))
+        m_entries.push_back(std::move(e));
+    }
+
+    for (size_t idx = 0; idx < m_entries.size(); ++idx) {
+      m_by_uuid.emplace(m_entries[idx].uuid, idx);
+      for (const auto& kernel : m_entries[idx].kernels)
+        m_by_kernel.emplace(kernel, idx);
+    }
+
+    if (dirty && !cache.empty())
+      write_cache(cache);
+  }
+
+  // Path to xclbin with specified uuid, empty if no such xclbin
+  [[nodiscard]] std::string
+  find_by_uuid(const std::string& xid) const
+  {
+    auto itr = m_by_uuid.find(xid);
+    return itr != m_by_uuid.end() ? m_entries[itr->second].path : std::string{};
+  }
+
+  // Paths to xclbins with specified kernel
+  [[nodiscard]] std::vector<std::string>
+  find_by_kernel(const std::string& name) const
+  {
+    std::vector<std::string> paths;
+    auto range = m_by_kernel.equal_range(name);
+    for (auto itr = range.first; itr != range.second; ++itr)
+      paths.push_back(m_entries[itr->second].path);
+    std::sort(paths.begin(), paths.end());
+    return paths;
+  }
+};
+
 // class xclbin_repository_impl - implementation of xclbin_repository
 //
 // Handle class for xrt::xclbin_repository.  The implementation is
@@ -959,6 +1298,19 @@ class xclbin_repository_impl
   std::vector<std::filesystem::path> m_paths;
   std::vector<std::filesystem::path> m_xclbin_paths;
 
+  // Index is built on first lookup by uuid or kernel name
+  mutable std::once_flag m_index_flag;
+  mutable std::unique_ptr<xclbin_repository_index> m_index;
+
+  const xclbin_repository_index&
+  get_index() const
+  {
+    std::call_once(m_index_flag, [this] {
+      m_index = std::make_unique<xclbin_repository_index>(m_paths, m_xclbin_paths);
+    });
+    return *m_index;
+  }
+
   static std::vector<std::filesystem::path>
   get_xclbin_paths(const std::vector<std::filesystem::path>& dirs)
   {
@@ -1013,6 +1365,22 @@ public:
 
     throw std::runtime_error("xclbin file not found: " + name);
   }
+
+  [[nodiscard]] xclbin
+  load_by_uuid(const uuid& xid) const
+  {
+    auto path = get_index().find_by_uuid(xid.to_string());
+    if (path.empty())
+      throw std::runtime_error("xclbin with uuid not found: " + xid.to_string());
+
+    return xclbin{path};
+  }
+
+  [[nodiscard]] std::vector<std::string>
+  find_by_kernel(const std::string& name) const
+  {
+    return get_index().find_by_kernel(name);
+  }
 };
 
 } // xrt
@@ -1477,6 +1845,20 @@ load(const std::string& name) const
   return handle->load(name);
 }
 
+xclbin
+xclbin_repository::
+load_by_uuid(const uuid& xid) const
+{
+  return handle->load_by_uuid(xid);
+}
+
+std::vector<std::string>
+xclbin_repository::
+find_by_kernel(const std::string& name) const
+{
+  return handle->find_by_kernel(name);
+}
+
 ////////////////////////////////////////////////////////////////
 // xrt::xclbin_repository::iterator
 ////////////////////////////////////////////////////////////////
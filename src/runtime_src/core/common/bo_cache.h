@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2019 Xilinx, Inc
-// Copyright (C) 2022-2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #ifndef core_common_bo_cache_h_
 #define core_common_bo_cache_h_
@@ -10,9 +10,16 @@
 #include "core/common/shim/buffer_handle.h"
 #include "core/include/xrt/detail/ert.h"
 
-#include <vector>
-#include <utility>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #ifdef _WIN32
 # pragma warning( push )
@@ -21,8 +28,293 @@
 
 namespace xrt_core {
 
-// Create a cache of CMD BO objects -- for now only used for M2M -- to reduce
-// the overhead of BO life cycle management.
+// class bo_pool - Per device pool of mapped BOs in size classes
+//
+// Caches BOs of one type (flags) to reduce the overhead of BO life
+// cycle management for short lived buffers such as command BOs and
+// host side staging buffers.
+//
+// Requested sizes are rounded up to a power of two size class, from
+// one page up to max_class_size.  Larger BOs are never cached.
+//
+// Released BOs are kept in a shard selected by the releasing thread,
+// so threads that allocate and release from the same thread contend
+// only on their own shard.  Shards hold at most shard_depth BOs per
+// size class, when a shard is full half of the BOs in that size class
+// are moved to a global overflow list, and when a shard is empty it
+// is refilled from the overflow list.
+//
+// The total number of cached bytes is bounded by a high watermark.
+// When a release pushes the cache above the high watermark, cached
+// BOs are evicted until the cache is below the low watermark.  A
+// high watermark of 0 disables caching.
+//
+// A reused BO has the content of its previous owner unless the pool
+// is constructed with zero_fill, in which case the requested range
+// is cleared before the BO is handed out, same as a new BO from the
+// driver.
+//
+// The pool does not keep its device alive, the owner of the pool
+// must ensure the device outlives the pool.
+class bo_pool
+{
+public:
+  // Mapped BO as handed out by the pool, 'size' is the size class
+  // of the BO, which may be larger than the requested size.
+  struct buffer
+  {
+    std::unique_ptr<buffer_handle> handle;
+    void* map = nullptr;
+    size_t size = 0;
+  };
+
+  struct stats
+  {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t cached_bytes;
+  };
+
+private:
+  static constexpr size_t min_class_size = 4096;
+  static constexpr size_t max_class_size = 16 * 1024 * 1024;
+  static constexpr size_t num_classes = 13;  // 4K .. 16M
+  static constexpr size_t num_shards = 8;
+  static constexpr size_t shard_depth = 8;
+
+  using bin_type = std::vector<buffer>;
+  using bins_type = std::array<bin_type, num_classes>;
+
+  struct shard
+  {
+    std::mutex mutex;
+    bins_type bins;
+  };
+
+  device* m_device;
+  const uint64_t m_flags;
+  const size_t m_high_watermark;
+  const size_t m_low_watermark;
+  const bool m_zero_fill;
+
+  std::array<shard, num_shards> m_shards;
+  std::mutex m_overflow_mutex;
+  bins_type m_overflow;
+
+  std::atomic<uint64_t> m_cached_bytes {0};
+  std::atomic<uint64_t> m_hits {0};
+  std::atomic<uint64_t> m_misses {0};
+  std::atomic<uint64_t> m_evictions {0};
+
+  static size_t
+  get_class(size_t size)
+  {
+    size_t cls = 0;
+    for (size_t csz = min_class_size; csz < size; csz <<= 1)
+      ++cls;
+    return cls;
+  }
+
+  static size_t
+  get_class_size(size_t cls)
+  {
+    return min_class_size << cls;
+  }
+
+  shard&
+  get_shard()
+  {
+    thread_local const size_t idx = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return m_shards[idx % num_shards];
+  }
+
+  static void
+  destroy(buffer& bo)
+  {
+    try {
+      bo.handle->unmap(bo.map);
+    }
+    catch (...) {
+    }
+    bo.handle.reset();
+  }
+
+  // Evict from the overflow list first, then from the shards, until
+  // the cache is below the low watermark.  Largest BOs are evicted first.
+  void
+  evict()
+  {
+    auto evict_bins = [this](bins_type& bins) {
+      for (auto cls = num_classes; cls-- > 0 && m_cached_bytes > m_low_watermark;) {
+        auto& bin = bins[cls];
+        while (!bin.empty() && m_cached_bytes > m_low_watermark) {
+          auto bo = std::move(bin.back());
+          bin.pop_back();
+          m_cached_bytes -= bo.size;
+          ++m_evictions;
+          destroy(bo);
+        }
+      }
+    };
+
+    {
+      std::lock_guard lk(m_overflow_mutex);
+      evict_bins(m_overflow);
+    }
+
+    for (auto& sh : m_shards) {
+      if (m_cached_bytes <= m_low_watermark)
+        break;
+      std::lock_guard lk(sh.mutex);
+      evict_bins(sh.bins);
+    }
+  }
+
+  buffer
+  alloc_new(size_t size)
+  {
+    auto handle = m_device->alloc_bo(size, m_flags);
+    auto map = handle->map(buffer_handle::map_type::write);
+    return {std::move(handle), map, size};
+  }
+
+public:
+  bo_pool(device* device, uint64_t flags, size_t high_watermark, size_t low_watermark, bool zero_fill = false)
+    : m_device(device)
+    , m_flags(flags)
+    , m_high_watermark(high_watermark)
+    , m_low_watermark(std::min(low_watermark, high_watermark))
+    , m_zero_fill(zero_fill)
+  {}
+
+  ~bo_pool()
+  {
+    try {
+      for (auto& sh : m_shards)
+        for (auto& bin : sh.bins)
+          for (auto& bo : bin)
+            destroy(bo);
+      for (auto& bin : m_overflow)
+        for (auto& bo : bin)
+          destroy(bo);
+    }
+    catch (...) {
+    }
+  }
+
+  bo_pool(const bo_pool&) = delete;
+  bo_pool(bo_pool&&) = delete;
+  bo_pool& operator=(const bo_pool&) = delete;
+  bo_pool& operator=(bo_pool&&) = delete;
+
+  // Get a mapped BO of at least 'size' bytes
+  buffer
+  alloc(size_t size)
+  {
+    if (!m_high_watermark || size > max_class_size)
+      return alloc_new(size);
+
+    auto cls = get_class(size);
+    auto& sh = get_shard();
+    buffer bo;
+    {
+      std::lock_guard lk(sh.mutex);
+      auto& bin = sh.bins[cls];
+      if (bin.empty()) {
+        // Refill half a shard from the overflow list
+        std::lock_guard olk(m_overflow_mutex);
+        auto& obin = m_overflow[cls];
+        while (!obin.empty() && bin.size() < shard_depth / 2) {
+          bin.push_back(std::move(obin.back()));
+          obin.pop_back();
+        }
+      }
+
+      if (!bin.empty()) {
+        bo = std::move(bin.back());
+        bin.pop_back();
+        m_cached_bytes -= bo.size;
+        ++m_hits;
+      }
+    }
+
+    if (bo.handle) {
+      if (m_zero_fill)
+        std::memset(bo.map, 0, size);
+      return bo;
+    }
+
+    ++m_misses;
+    return alloc_new(get_class_size(cls));
+  }
+
+  // Return a BO previously allocated from this pool
+  void
+  release(buffer&& bo)
+  {
+    if (!m_high_watermark || bo.size > max_class_size) {
+      destroy(bo);
+      return;
+    }
+
+    auto cls = get_class(bo.size);
+    auto& sh = get_shard();
+    {
+      std::lock_guard lk(sh.mutex);
+      auto& bin = sh.bins[cls];
+      if (bin.size() >= shard_depth) {
+        // Spill half the shard to the overflow list
+        std::lock_guard olk(m_overflow_mutex);
+        auto& obin = m_overflow[cls];
+        while (bin.size() > shard_depth / 2) {
+          obin.push_back(std::move(bin.back()));
+          bin.pop_back();
+        }
+      }
+      m_cached_bytes += bo.size;
+      bin.push_back(std::move(bo));
+    }
+
+    if (m_cached_bytes > m_high_watermark)
+      evict();
+  }
+
+  // Release all cached BOs
+  void
+  clear()
+  {
+    auto clear_bins = [this](bins_type& bins) {
+      for (auto& bin : bins) {
+        for (auto& bo : bin) {
+          m_cached_bytes -= bo.size;
+          destroy(bo);
+        }
+        bin.clear();
+      }
+    };
+
+    {
+      std::lock_guard lk(m_overflow_mutex);
+      clear_bins(m_overflow);
+    }
+
+    for (auto& sh : m_shards) {
+      std::lock_guard lk(sh.mutex);
+      clear_bins(sh.bins);
+    }
+  }
+
+  stats
+  get_stats() const
+  {
+    return {m_hits.load(), m_misses.load(), m_evictions.load(), m_cached_bytes.load()};
+  }
+};
+
+// Create a cache of CMD BO objects to reduce the overhead of BO life
+// cycle management.  The cache is a bo_pool of exec BOs with a single
+// size class.
 template <size_t BoSize>
 class bo_cache_t {
 public:
@@ -37,84 +329,39 @@ private:
   // correct pagesize. unmap always unmaps the full page.
   static constexpr size_t m_bo_size = BoSize;
   std::shared_ptr<device> m_device;
-  // Maximum number of BOs that can be cached in the pool. Value of 0 indicates
-  // caching should be disabled.
-  const unsigned int m_cache_max_size;
-  std::vector<cmd_bo<void>> m_cmd_bo_cache;
-  std::mutex m_mutex;
+  bo_pool m_pool;
 
 public:
+  // Maximum number of BOs that can be cached is 'max_size'. Value of 0
+  // indicates caching should be disabled.
   bo_cache_t(std::shared_ptr<xrt_core::device> device, unsigned int max_size)
-    : m_device(std::move(device)), m_cache_max_size(max_size)
+    : m_device(std::move(device))
+    , m_pool(m_device.get(), XCL_BO_FLAGS_EXECBUF, max_size * m_bo_size, max_size * m_bo_size)
   {}
 
   bo_cache_t(xclDeviceHandle handle, unsigned int max_size)
-    : m_device(get_userpf_device(handle)), m_cache_max_size(max_size)
+    : bo_cache_t(get_userpf_device(handle), max_size)
   {}
 
-  ~bo_cache_t()
-  {
-    try {
-      std::lock_guard<std::mutex> lock(m_mutex);
-      for (auto& bo : m_cmd_bo_cache)
-        destroy(bo);
-    }
-    catch (...) {
-    }
-  }
-
   template<typename T>
   cmd_bo<T>
   alloc()
   {
-    auto bo = alloc_impl();
-    return std::make_pair(std::move(bo.first), static_cast<T *>(bo.second));
+    auto bo = m_pool.alloc(m_bo_size);
+    return std::make_pair(std::move(bo.handle), static_cast<T *>(bo.map));
   }
 
   template<typename T>
   void
   release(cmd_bo<T>&& bo)
   {
-    release_impl(std::make_pair(std::move(bo.first), static_cast<void *>(bo.second)));
-  }
-
-private:
-  cmd_bo<void>
-  alloc_impl()
-  {
-    if (m_cache_max_size) {
-      // If caching is enabled first look up in the BO cache
-      std::lock_guard lock(m_mutex);
-      if (!m_cmd_bo_cache.empty()) {
-        auto bo = std::move(m_cmd_bo_cache.back());
-        m_cmd_bo_cache.pop_back();
-        return bo;
-      }
-    }
-
-    auto execHandle = m_device->alloc_bo(m_bo_size, XCL_BO_FLAGS_EXECBUF);
-    auto map = execHandle->map(buffer_handle::map_type::write);
-    return std::make_pair(std::move(execHandle), map);
+    m_pool.release({std::move(bo.first), static_cast<void *>(bo.second), m_bo_size});
   }
 
-  void
-  release_impl(cmd_bo<void>&& bo)
-  {
-    if (m_cache_max_size) {
-      // If caching is enabled and BO cache is not fully populated add this the cache
-      std::lock_guard lock(m_mutex);
-      if (m_cmd_bo_cache.size() < m_cache_max_size) {
-        m_cmd_bo_cache.push_back(std::move(bo));
-        return;
-      }
-    }
-    destroy(bo);
-  }
-
-  void
-  destroy(const cmd_bo<void>& bo)
+  bo_pool::stats
+  get_stats() const
   {
-    bo.first->unmap(bo.second);
+    return m_pool.get_stats();
   }
 };
 
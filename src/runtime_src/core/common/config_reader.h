@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2016-2022 Xilinx, Inc. All rights reserved.
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #ifndef xrtcore_config_reader_h_
 #define xrtcore_config_reader_h_
@@ -247,6 +247,27 @@ get_trace_buffer_size()
   return value;
 }
 
+// Memory ceiling for each stream of trace events held by the
+// profiling database (native host events, PL events of a device).
+// Above it, events are spilled to disk and merged when the trace
+// files are written.  "0" keeps all events in memory.
+inline std::string
+get_trace_memory_limit()
+{
+  static std::string value = detail::get_string_value("Debug.trace_memory_limit", "0");
+  return value;
+}
+
+// Write the host and device trace of all XDP plugins, in addition to
+// their own trace files, to one file in the Chrome JSON trace event
+// format that Perfetto loads directly.
+inline bool
+get_chrome_trace()
+{
+  static bool value = detail::get_bool_value("Debug.chrome_trace", false);
+  return value;
+}
+
 inline bool
 get_ml_timeline()
 {
@@ -639,6 +660,90 @@ get_cmdbo_cache()
   return value;
 }
 
+/**
+ * Use completion dispatch for legacy kds command waits.  Only the
+ * waiters of completed commands are woken rather than all waiters.
+ */
+inline bool
+get_exec_wait_dispatch()
+{
+  static bool value = detail::get_bool_value("Runtime.exec_wait_dispatch",false);
+  return value;
+}
+
+/**
+ * Default policy for xrt::run::wait.  "block" (default) blocks until
+ * the run completes, "hybrid" polls the run state for an adaptive
+ * spin budget before blocking.
+ */
+inline std::string
+get_run_wait_policy()
+{
+  static std::string value = detail::get_string_value("Runtime.run_wait_policy","block");
+  return value;
+}
+
+/**
+ * Upper bound in microseconds of the spin budget used by the hybrid
+ * run wait policy.  Runs that take longer than this are not polled.
+ */
+inline unsigned int
+get_run_wait_spin_us()
+{
+  static unsigned int value = detail::get_uint_value("Runtime.run_wait_spin_us",50);
+  return value;
+}
+
+/**
+ * Number of runs chained per command submitted by xrt::runlist.
+ * Value 0 adapts the chain size to the observed per run latency,
+ * the value is otherwise capped by the maximum chain size supported.
+ */
+inline unsigned int
+get_runlist_chain_size()
+{
+  static unsigned int value = detail::get_uint_value("Runtime.runlist_chain_size",24);
+  return value;
+}
+
+/**
+ * Size in MB of per device pool of host only and cacheable buffers
+ * allocated by xrt::bo.  Value of 0 disables pooling.
+ */
+inline unsigned int
+get_bo_pool_size_mb()
+{
+  static unsigned int value = detail::get_uint_value("Runtime.bo_pool_size_mb",0);
+  return value;
+}
+
+/**
+ * Memory map xclbin files constructed from a file name rather than
+ * reading the file into memory.  The mapping is read only, sections
+ * are referenced in place and pages are loaded by the OS only when
+ * accessed.  The file must not be modified while the xclbin object is
+ * alive.
+ */
+inline bool
+get_xclbin_mmap()
+{
+  static bool value = detail::get_bool_value("Runtime.xclbin_mmap",false);
+  return value;
+}
+
+/**
+ * Persist the index of xclbin repositories under $XDG_CACHE_HOME/xrt
+ * (or $HOME/.cache/xrt) such that repository lookups by uuid or kernel
+ * name need not read xclbin files that are unchanged since last use.
+ * Off by default, the index is then kept in memory only.
+ */
+inline bool
+get_xclbin_repository_cache()
+{
+  static bool value = detail::get_bool_value("Runtime.xclbin_repository_cache",false);
+  return value;
+}
+
 inline std::string
 get_hw_em_driver()
 {
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2019-2022 Xilinx, Inc.  All rights reserved.
-// Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved.
 #ifndef XRT_CORE_DEVICE_H
 #define XRT_CORE_DEVICE_H
 
@@ -37,6 +37,8 @@
 
 namespace xrt_core {
 
+class bo_pool;
+
 using device_collection = std::vector<std::shared_ptr<xrt_core::device>>;
 
 /**
@@ -501,6 +503,18 @@ public:
   std::shared_ptr<context_mgr>
   get_context_mgr();
 
+  /**
+   * get_bo_pool() - get pool of mapped BOs, create one if it is not there yet
+   *
+   * @flags: BO flags, including memory group, of BOs in the pool
+   * @size:  Maximum number of bytes cached by a new pool
+   *
+   * The pool is owned by the device and its cached BOs are freed
+   * when the device is destructed.
+   */
+  std::shared_ptr<bo_pool>
+  get_bo_pool(uint64_t flags, size_t size);
+
  private:
   id_type m_device_id;
   mutable boost::optional<bool> m_nodma = boost::none;
@@ -515,6 +529,7 @@ public:
   mutable std::mutex m_mutex;
   std::shared_ptr<usage_metrics::base_logger> m_usage_logger = usage_metrics::get_usage_metrics_logger();
   std::shared_ptr<context_mgr> m_ctx_mgr; // per device context manager
+  std::map<uint64_t, std::shared_ptr<bo_pool>> m_bo_pools; // per device BO pools by flags
 };
 
 /**
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef xrt_core_common_hdr_histogram_h_
+#define xrt_core_common_hdr_histogram_h_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace xrt_core {
+
+// class hdr_histogram - Fixed size log-linear histogram of values
+//
+// Records unsigned 64-bit values (typically nanoseconds) with a
+// bounded relative error in the style of HdrHistogram.  Values less
+// than sub_bucket_count are recorded exactly, larger values are
+// recorded in buckets whose width is 1/64 of the power of two range
+// they fall into, so the relative error is less than 1.6%.
+//
+// Recording is a handful of integer operations and one increment
+// with no allocation, so it can be used on hot paths.  The class is
+// not thread safe; use one histogram per thread and merge with add().
+class hdr_histogram
+{
+  static constexpr unsigned int sub_bucket_bits = 7;
+  static constexpr uint64_t sub_bucket_count = 1ULL << sub_bucket_bits;    // 128
+  static constexpr uint64_t sub_bucket_half = sub_bucket_count / 2;         // 64
+  static constexpr unsigned int max_shift = 64 - (sub_bucket_bits - 1);     // 58
+  static constexpr size_t bucket_count = sub_bucket_count + (max_shift - 1) * sub_bucket_half;
+
+  std::array<uint64_t, bucket_count> m_counts {};
+  uint64_t m_total = 0;
+  uint64_t m_min = std::numeric_limits<uint64_t>::max();
+  uint64_t m_max = 0;
+  long double m_sum = 0;
+
+  static unsigned int
+  msb(uint64_t value)
+  {
+    unsigned int bit = 0;
+    while (value >>= 1)
+      ++bit;
+    return bit;
+  }
+
+  static size_t
+  to_index(uint64_t value)
+  {
+    if (value < sub_bucket_count)
+      return static_cast<size_t>(value);
+
+    // shift such that the mantissa keeps sub_bucket_bits-1 bits after msb
+    auto shift = msb(value) - (sub_bucket_bits - 1);
+    auto mantissa = value >> shift;  // [64, 127]
+    return static_cast<size_t>(sub_bucket_count + (shift - 1) * sub_bucket_half + (mantissa - sub_bucket_half));
+  }
+
+  // Highest value that maps to the same index as idx
+  static uint64_t
+  highest_equivalent(size_t idx)
+  {
+    if (idx < sub_bucket_count)
+      return idx;
+
+    auto rel = idx - sub_bucket_count;
+    auto shift = static_cast<unsigned int>(rel / sub_bucket_half) + 1;
+    auto mantissa = sub_bucket_half + (rel % sub_bucket_half);
+    return ((mantissa + 1) << shift) - 1;
+  }
+
+public:
+  void
+  record(uint64_t value)
+  {
+    ++m_counts[to_index(value)];
+    ++m_total;
+    m_sum += value;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+  }
+
+  // Merge another histogram into this one
+  void
+  add(const hdr_histogram& other)
+  {
+    for (size_t idx = 0; idx < bucket_count; ++idx)
+      m_counts[idx] += other.m_counts[idx];
+    m_total += other.m_total;
+    m_sum += other.m_sum;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+  }
+
+  void
+  reset()
+  {
+    *this = hdr_histogram{};
+  }
+
+  uint64_t
+  count() const
+  {
+    return m_total;
+  }
+
+  uint64_t
+  min() const
+  {
+    return m_total ? m_min : 0;
+  }
+
+  uint64_t
+  max() const
+  {
+    return m_max;
+  }
+
+  double
+  mean() const
+  {
+    return m_total ? static_cast<double>(m_sum / m_total) : 0.0;
+  }
+
+  // Value at percentile (0.0 - 100.0).  The returned value is the
+  // highest value equivalent to the bucket containing the percentile,
+  // clamped to the recorded max.
+  uint64_t
+  percentile(double pct) const
+  {
+    if (!m_total)
+      return 0;
+
+    pct = std::clamp(pct, 0.0, 100.0);
+    auto target = static_cast<uint64_t>(std::ceil(pct / 100.0 * m_total));
+    target = std::max<uint64_t>(target, 1);
+
+    uint64_t running = 0;
+    for (size_t idx = 0; idx < bucket_count; ++idx) {
+      running += m_counts[idx];
+      if (running >= target)
+        return std::min(highest_equivalent(idx), m_max);
+    }
+    return m_max;
+  }
+};
+
+} // xrt_core
+
+#endif
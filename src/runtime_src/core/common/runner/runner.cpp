@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024-2025 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 #define XCL_DRIVER_DLL_EXPORT  // in same dll as exported xrt apis
 #define XRT_CORE_COMMON_SOURCE // in same dll as coreutil
 #define XRT_API_SOURCE         // in same dll as coreutil
@@ -14,6 +14,7 @@
 #include "core/common/debug.h"
 #include "core/common/dlfcn.h"
 #include "core/common/error.h"
+#include "core/common/hdr_histogram.h"
 #include "core/common/module_loader.h"
 #include "core/common/time.h"
 #include "core/common/api/bo_int.h"
@@ -381,6 +382,22 @@ public:
     get_section(section).insert(j.begin(), j.end());
   }
 
+  // Add latency percentiles from a histogram of nanosecond values.
+  // Values are reported in microseconds with keys prefixed by
+  // 'prefix', e.g. add(cpu, "latency", hist) adds latency_p50, ...
+  void
+  add(section_type section, const std::string& prefix, const xrt_core::hdr_histogram& hist)
+  {
+    auto us = [&hist](double pct) { return hist.percentile(pct) / 1000; };
+    add(section, {
+        {prefix + "_p50", us(50.0)},
+        {prefix + "_p90", us(90.0)},
+        {prefix + "_p99", us(99.0)},
+        {prefix + "_p999", us(99.9)},
+        {prefix + "_max", hist.max() / 1000}
+      });
+  }
+
   // Add content of another report object to this
   // report object.
   void
@@ -1324,6 +1341,8 @@ class recipe
     size_t m_runlist_threshold = default_runlist_threshold;
     std::vector<std::unique_ptr<runlist>> m_runlists;
     std::vector<xrt::queue::event> m_events;  // Events that signal complettion of a runlist
+    xrt_core::hdr_histogram m_runlist_latency; // Per runlist execution latency (ns)
+    size_t m_warmup = 0;                      // Iterations excluded from latency
 
 
     static std::vector<std::unique_ptr<runlist>>
@@ -1462,8 +1481,13 @@ class recipe
         if (iteration > 0)
           m_events[count].wait();
 
+        // Runlists execute in sequence on the queue's worker thread, so
+        // the latency histogram needs no synchronization
         m_events[count++] = m_queue.enqueue([this, iteration, &runlist] {
+          auto start = xrt_core::time_ns();
           execute_runlist(iteration, runlist.get(), m_eptr);
+          if (iteration >= m_warmup)
+            m_runlist_latency.record(xrt_core::time_ns() - start);
         });
       }
     }
@@ -1494,6 +1518,21 @@ class recipe
       std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
     }
 
+    // Number of initial iterations to exclude from latency metrics
+    void
+    set_warmup(size_t warmup)
+    {
+      m_warmup = warmup;
+    }
+
+    // Clear latency metrics of previous executions.  Must not be
+    // called while the recipe is executing.
+    void
+    reset_latency()
+    {
+      m_runlist_latency.reset();
+    }
+
     report
     get_report() const
     {
@@ -1501,6 +1540,12 @@ class recipe
       rpt.add(report::section_type::resources, {{"runs", num_runs()}});
       rpt.add(report::section_type::resources, {{"runlist_threshold", m_runlist_threshold}});
       rpt.add(report::section_type::resources, {{"runlist", num_runs() >= m_runlist_threshold}});
+
+      // Per runlist latency is tracked only when the recipe has
+      // multiple runlists, otherwise it is the iteration latency
+      if (m_runlist_latency.count())
+        rpt.add(report::section_type::cpu, "runlist_latency", m_runlist_latency);
+
       return rpt;
     }
   }; // class recipe::execution
@@ -1585,6 +1630,18 @@ public:
     m_execution.sleep(sleep_ms);
   }
 
+  void
+  set_warmup(size_t warmup)
+  {
+    m_execution.set_warmup(warmup);
+  }
+
+  void
+  reset_latency()
+  {
+    m_execution.reset_latency();
+  }
+
   report
   get_report() const
   {
@@ -1933,6 +1990,7 @@ class profile
   // {
   //  "execution" : {
   //    "iterations": 2,   (1)
+  //    "warmup": 1,       (0)
   //    "verbose": bool,   (true)
   //    "validate": bool,  (false)
   //    "iteration" : {
@@ -1946,6 +2004,8 @@ class profile
   // The execution section specifies how a recipe should be executed.
   // - "iterations" specfies how many times the recipe should be
   //    executed when the application calls xrt::runnner::execute().
+  // - "warmup" specifies how many initial iterations are excluded
+  //    from the latency percentiles.
   // - "verbose" can be used to turn off printing of metrics
   // - "validate" enables validation per binding nodes after all
   //   iterations have completed
@@ -1960,15 +2020,22 @@ class profile
   //    next iteration.
   // - "validate" means buffer validation per what is specified in
   //   the binding element.
+  //
+  // The latency of each iteration is recorded in a histogram.  The
+  // latency is the time to submit the iteration, which includes
+  // waiting for the previous iteration to complete, plus the time to
+  // wait for the iteration itself if "wait" is specified.
   class execution
   {
     using iteration_node = json;
     profile* m_profile;
     size_t m_iterations;
+    size_t m_warmup;
     iteration_node m_iteration;
     mutable report m_report;
     bool m_verbose = false;
     bool m_validate = false;
+    xrt_core::hdr_histogram m_latency; // Per iteration latency (ns)
 
     void
     execute_iteration(size_t iteration)
@@ -1983,12 +2050,16 @@ class profile
       if (iteration > 0 && m_iteration.value("init", false))
         m_profile->reinit(iteration);
       
+      auto start = xrt_core::time_ns();
       m_profile->execute_recipe(iteration);
 
       // Wait execution to complete if requested
       if (m_iteration.value("wait", false))
         m_profile->wait_recipe();
 
+      if (iteration >= m_warmup)
+        m_latency.record(xrt_core::time_ns() - start);
+
       if (auto sleep_ms = m_iteration.value("sleep", 0))
         m_profile->sleep_recipe(sleep_ms);
 
@@ -2001,10 +2072,17 @@ class profile
     execution(profile* pr, const json& j)
       : m_profile(pr)
       , m_iterations(j.value("iterations", 1))
+      , m_warmup(j.value("warmup", 0))
       , m_iteration(j.value("iteration", json::object()))
       , m_verbose(j.value("verbose", true))
       , m_validate(j.value("validate", false))
     {
+      if (m_warmup >= m_iterations)
+        throw profile_error("warmup (" + std::to_string(m_warmup) + ") must be less than iterations ("
+                            + std::to_string(m_iterations) + ")");
+
+      m_profile->set_warmup(m_warmup);
+
       // Bind buffers to the recipe prior to executing the recipe. This
       // will bind the buffers which have binding::bind set to true.
       m_profile->bind();
@@ -2014,6 +2092,10 @@ class profile
     void
     execute()
     {
+      // Latency metrics are per execution of the profile
+      m_latency.reset();
+      m_profile->reset_latency();
+
       unsigned long long time_ns = 0;
       {
         xrt_core::time_guard tg(time_ns);
@@ -2035,10 +2117,18 @@ class profile
       m_report.add(report::section_type::cpu, {{"elapsed", elapsed}});
       m_report.add(report::section_type::cpu, {{"latency", latency}});
       m_report.add(report::section_type::cpu, {{"throughput", throughput}});
+      m_report.add(report::section_type::cpu, {{"warmup", m_warmup}});
+      m_report.add(report::section_type::cpu, "latency", m_latency);
       if (m_verbose) {
         std::cout << "Elapsed time (us): " << elapsed << "\n";
         std::cout << "Average Latency (us): " << latency << "\n";
         std::cout << "Average Throughput (op/s): " << throughput << "\n";
+        std::cout << "Iteration Latency (us): "
+                  << "p50=" << m_latency.percentile(50.0) / 1000
+                  << " p90=" << m_latency.percentile(90.0) / 1000
+                  << " p99=" << m_latency.percentile(99.0) / 1000
+                  << " p99.9=" << m_latency.percentile(99.9) / 1000
+                  << " max=" << m_latency.max() / 1000 << "\n";
       }
       // NOLINTEND
     }
@@ -2117,6 +2207,18 @@ private:
     m_recipe.sleep(time_ms);
   }
 
+  void
+  set_warmup(size_t warmup)
+  {
+    m_recipe.set_warmup(warmup);
+  }
+
+  void
+  reset_latency()
+  {
+    m_recipe.reset_latency();
+  }
+
 private:
   static xrt::hw_context::qos_type
   init_qos(const json& j)
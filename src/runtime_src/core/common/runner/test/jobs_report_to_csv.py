@@ -1,5 +1,5 @@
 # SPDX-License-Identifier: Apache-2.0
-# Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+# Copyright (C) 2025-2026 Advanced Micro Devices, Inc. All rights reserved.
 import json
 import csv
 import sys
@@ -12,7 +12,18 @@ PROPERTY_MAP = {
     'cpu_elapsed': ('cpu', 'elapsed'),
     'cpu_iterations': ('cpu', 'iterations'),
     'cpu_latency': ('cpu', 'latency'),
+    'cpu_latency_p50': ('cpu', 'latency_p50'),
+    'cpu_latency_p90': ('cpu', 'latency_p90'),
+    'cpu_latency_p99': ('cpu', 'latency_p99'),
+    'cpu_latency_p999': ('cpu', 'latency_p999'),
+    'cpu_latency_max': ('cpu', 'latency_max'),
+    'cpu_runlist_latency_p50': ('cpu', 'runlist_latency_p50'),
+    'cpu_runlist_latency_p90': ('cpu', 'runlist_latency_p90'),
+    'cpu_runlist_latency_p99': ('cpu', 'runlist_latency_p99'),
+    'cpu_runlist_latency_p999': ('cpu', 'runlist_latency_p999'),
+    'cpu_runlist_latency_max': ('cpu', 'runlist_latency_max'),
     'cpu_throughput': ('cpu', 'throughput'),
+    'cpu_warmup': ('cpu', 'warmup'),
     'hwctx_columns': ('hwctx', 'columns'),
     'resources_buffers': ('resources', 'buffers'),
     'resources_kernels': ('resources', 'kernels'),
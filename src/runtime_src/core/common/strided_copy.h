@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef xrt_core_common_strided_copy_h_
+#define xrt_core_common_strided_copy_h_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace xrt_core {
+
+// struct rect_range - Byte range of a buffer covered by a rectangle
+//
+// @offset: offset of first byte of rectangle
+// @size: bytes from first to last byte of rectangle inclusive
+struct rect_range
+{
+  size_t offset = 0;
+  size_t size = 0;
+};
+
+// rect_byte_range() - Byte range covered by a 3D rectangle
+//
+// @origin: (x in bytes, y in rows, z in slices) of rectangle
+// @region: (width in bytes, height in rows, depth in slices)
+// @row_pitch: bytes per row
+// @slice_pitch: bytes per slice
+//
+// The range includes the bytes between rows and slices that are not
+// part of the rectangle.
+inline rect_range
+rect_byte_range(const size_t* origin, const size_t* region, size_t row_pitch, size_t slice_pitch)
+{
+  rect_range range;
+  range.offset = origin[2] * slice_pitch + origin[1] * row_pitch + origin[0];
+  if (region[0] && region[1] && region[2])
+    range.size = (region[2] - 1) * slice_pitch + (region[1] - 1) * row_pitch + region[0];
+  return range;
+}
+
+// set_default_rect_pitches() - Pitches of a tightly packed layout
+//
+// @row_pitch: bytes per row, set to region[0] if zero
+// @slice_pitch: bytes per slice, set to region[1] * row_pitch if zero
+// @region: (width in bytes, height in rows, depth in slices)
+//
+// Pitches that are zero are computed as for OpenCL rectangle copies.
+inline void
+set_default_rect_pitches(size_t& row_pitch, size_t& slice_pitch, const size_t* region)
+{
+  if (!row_pitch)
+    row_pitch = region[0];
+  if (!slice_pitch)
+    slice_pitch = region[1] * row_pitch;
+}
+
+namespace detail {
+
+// Copy rows [begin, end) of a rectangle, rows are numbered slice
+// major.
+inline void
+copy_rect_rows(char* dst, size_t dst_row_pitch, size_t dst_slice_pitch,
+               const char* src, size_t src_row_pitch, size_t src_slice_pitch,
+               size_t width, size_t height, size_t begin, size_t end)
+{
+  auto z = begin / height;
+  auto y = begin % height;
+  for (auto row = begin; row < end; ++row) {
+    std::memcpy(dst + z * dst_slice_pitch + y * dst_row_pitch,
+                src + z * src_slice_pitch + y * src_row_pitch,
+                width);
+    if (++y == height) {
+      y = 0;
+      ++z;
+    }
+  }
+}
+
+} // detail
+
+// Minimum rectangle size copied by more than one thread, and the
+// maximum number of threads copying a rectangle
+constexpr size_t parallel_copy_bytes = 4 * 1024 * 1024;
+constexpr size_t parallel_copy_max_threads = 8;
+
+// copy_rect() - Copy a 3D rectangle of bytes between strided layouts
+//
+// @dst: destination address of first byte of rectangle
+// @dst_row_pitch: destination bytes per row
+// @dst_slice_pitch: destination bytes per slice
+// @src: source address of first byte of rectangle
+// @src_row_pitch: source bytes per row
+// @src_slice_pitch: source bytes per slice
+// @region: (width in bytes, height in rows, depth in slices)
+//
+// Rows that are contiguous in both source and destination are merged
+// into one memcpy.  Rectangles of at least parallel_copy_bytes are
+// split by rows over worker threads, the calling thread copies the
+// last part.  Threads are created per call, so the split is for large
+// rectangles only.
+inline void
+copy_rect(void* dst, size_t dst_row_pitch, size_t dst_slice_pitch,
+          const void* src, size_t src_row_pitch, size_t src_slice_pitch,
+          const size_t* region)
+{
+  size_t width = region[0];
+  size_t height = region[1];
+  size_t depth = region[2];
+  if (!width || !height || !depth)
+    return;
+
+  // Merge rows that are contiguous in both layouts
+  if (dst_row_pitch == width && src_row_pitch == width) {
+    width *= height;
+    height = 1;
+    dst_row_pitch = src_row_pitch = width;
+    if (dst_slice_pitch == width && src_slice_pitch == width) {
+      width *= depth;
+      depth = 1;
+    }
+  }
+
+  auto d = static_cast<char*>(dst);
+  auto s = static_cast<const char*>(src);
+  size_t rows = height * depth;
+  size_t bytes = width * rows;
+
+  size_t nthreads = 1;
+  if (rows > 1 && bytes >= parallel_copy_bytes) {
+    size_t hw = std::max<size_t>(1, std::thread::hardware_concurrency());
+    nthreads = std::min({hw, parallel_copy_max_threads, rows, bytes / (parallel_copy_bytes / 4)});
+  }
+
+  if (nthreads <= 1) {
+    detail::copy_rect_rows(d, dst_row_pitch, dst_slice_pitch, s, src_row_pitch, src_slice_pitch,
+                           width, height, 0, rows);
+    return;
+  }
+
+  auto copy_part = [=](size_t part) {
+    detail::copy_rect_rows(d, dst_row_pitch, dst_slice_pitch, s, src_row_pitch, src_slice_pitch,
+                           width, height, rows * part / nthreads, rows * (part + 1) / nthreads);
+  };
+
+  // Parts that could not be given to a worker are copied here
+  std::vector<std::thread> workers;
+  size_t part = 0;
+  try {
+    workers.reserve(nthreads - 1);
+    for (; part < nthreads - 1; ++part)
+      workers.emplace_back(copy_part, part);
+  }
+  catch (...) {
+  }
+
+  for (; part < nthreads; ++part)
+    copy_part(part);
+
+  for (auto& worker : workers)
+    worker.join();
+}
+
+} // xrt_core
+
+#endif
@@ -1,5 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -21,13 +22,17 @@
 #include "debug.h"
 #include "config_reader.h"
 
+#include <atomic>
 #include <future>
 #include <functional>
 #include <chrono>
+#include <cstdint>
+#include <memory>
 #include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <iostream>
+#include <thread>
 
 #ifdef _WIN32
 # pragma warning( push )
@@ -233,7 +238,212 @@ public:
   }
 };
 
+/**
+ * Bounded lock-free multiple producer / multiple consumer queue
+ *
+ * Alternative to mpmcqueue for queues with many concurrent producers.
+ * The queue is a fixed size ring buffer of sequenced cells (Vyukov
+ * style), so neither producers nor consumers take a lock while the
+ * queue is non-empty and not full.
+ *
+ * Consumers spin for a bounded number of iterations before parking on
+ * a condition variable.  Producers only take the mutex and notify
+ * when at least one consumer is parked, and addWork(first, last)
+ * enqueues a batch of tasks with a single wakeup.
+ *
+ * A producer that finds the queue full yields until a slot becomes
+ * available.  Capacity must be a power of 2.
+ *
+ * Semantics otherwise follow mpmcqueue: getWork() returns a default
+ * constructed Task when the queue is stopped.
+ */
+template <typename Task, size_t Capacity = 1024>
+class bounded_mpmcqueue
+{
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "bounded_mpmcqueue capacity must be a power of 2");
+
+  static constexpr size_t cache_line_size = 64;
+  static constexpr size_t mask = Capacity - 1;
+  static constexpr unsigned default_spin = 2048;
+
+  struct alignas(cache_line_size) cell
+  {
+    std::atomic<size_t> seq;
+    Task data;
+  };
+
+  std::unique_ptr<cell[]> m_cells;
+  alignas(cache_line_size) std::atomic<size_t> m_enqueue_pos {0};
+  alignas(cache_line_size) std::atomic<size_t> m_dequeue_pos {0};
+  alignas(cache_line_size) std::atomic<unsigned int> m_sleepers {0};
+  std::atomic<bool> m_stop {false};
+  // No point spinning on a uniprocessor, the producer can't run
+  unsigned int m_spin = std::thread::hardware_concurrency() > 1 ? default_spin : 0;
+
+  // Slow path for parking consumers
+  std::mutex m_mutex;
+  std::condition_variable m_work;
+
+  bool
+  try_push(Task& t)
+  {
+    auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+    while (true) {
+      auto& c = m_cells[pos & mask];
+      auto seq = c.seq.load(std::memory_order_acquire);
+      auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+      if (diff == 0) {
+        if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          c.data = std::move(t);
+          c.seq.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0) {
+        return false; // full
+      }
+      else {
+        pos = m_enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool
+  try_pop(Task& t)
+  {
+    auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+    while (true) {
+      auto& c = m_cells[pos & mask];
+      auto seq = c.seq.load(std::memory_order_acquire);
+      auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          t = std::move(c.data);
+          c.seq.store(pos + Capacity, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0) {
+        return false; // empty
+      }
+      else {
+        pos = m_dequeue_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool
+  empty() const
+  {
+    auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+    return m_cells[pos & mask].seq.load(std::memory_order_acquire) != pos + 1;
+  }
+
+  void
+  push(Task& t)
+  {
+    while (!try_push(t))
+      std::this_thread::yield();
+  }
+
+  // Wake up parked consumers, if any.  The fence pairs with the
+  // fence in getWork() such that either the producer observes a
+  // sleeper or the sleeper observes the pushed task.
+  void
+  wake(size_t count)
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!m_sleepers.load(std::memory_order_relaxed))
+      return;
+
+    std::lock_guard<std::mutex> lk(m_mutex);
+    if (count > 1)
+      m_work.notify_all();
+    else
+      m_work.notify_one();
+  }
+
+public:
+  bounded_mpmcqueue()
+    : m_cells(new cell[Capacity])
+  {
+    for (size_t i = 0; i < Capacity; ++i)
+      m_cells[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  // Number of polling iterations before a consumer parks
+  explicit bounded_mpmcqueue(unsigned int spin)
+    : bounded_mpmcqueue()
+  {
+    m_spin = spin;
+  }
+
+  bounded_mpmcqueue(const bounded_mpmcqueue&) = delete;
+  bounded_mpmcqueue& operator=(const bounded_mpmcqueue&) = delete;
+
+  void
+  addWork(Task&& t)
+  {
+    push(t);
+    wake(1);
+  }
+
+  // Enqueue a range of tasks with one wakeup of parked consumers
+  template <typename Iterator>
+  void
+  addWork(Iterator first, Iterator last)
+  {
+    size_t count = 0;
+    for (; first != last; ++first, ++count)
+      push(*first);
+    if (count)
+      wake(count);
+  }
+
+  Task
+  getWork()
+  {
+    Task task {};
+    for (unsigned int i = 0; i < m_spin; ++i) {
+      if (m_stop.load(std::memory_order_relaxed))
+        return Task {};
+      if (!empty() && try_pop(task))
+        return task;
+    }
+
+    while (!m_stop.load(std::memory_order_relaxed)) {
+      if (try_pop(task))
+        return task;
+
+      std::unique_lock<std::mutex> lk(m_mutex);
+      m_sleepers.fetch_add(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      m_work.wait(lk, [this] { return m_stop.load() || !empty(); });
+      m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return Task {};
+  }
+
+  size_t
+  size() const
+  {
+    auto enq = m_enqueue_pos.load(std::memory_order_relaxed);
+    auto deq = m_dequeue_pos.load(std::memory_order_relaxed);
+    return enq > deq ? enq - deq : 0;
+  }
+
+  void
+  stop()
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    m_stop = true;
+    m_work.notify_all();
+  }
+};
+
 using queue = mpmcqueue<task>;
+using bounded_queue = bounded_mpmcqueue<task>;
 
 /**
  * event class wraps std::future<RT>
@@ -394,6 +604,20 @@ worker(queue& q)
 {
   return worker2(q,"");
 }
+
+// Worker for a bounded lock-free task queue.  The queue type is
+// selected by the owner of the queue, the worker simply runs until
+// the queue is stopped.
+inline void
+bounded_worker(bounded_queue& q)
+{
+  while (true) {
+    auto t = q.getWork();
+    if (!t.valid())
+      break;
+    t();
+  }
+}
 }} // task,xrt_core
 
 #ifdef _WIN32
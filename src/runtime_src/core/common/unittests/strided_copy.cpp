@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#include "core/common/strided_copy.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// Buffer of 'size' bytes where byte i has value i modulo 251 such that
+// misplaced bytes are detected
+std::vector<uint8_t>
+pattern(size_t size)
+{
+  std::vector<uint8_t> buf(size);
+  for (size_t i = 0; i < size; ++i)
+    buf[i] = static_cast<uint8_t>(i % 251);
+  return buf;
+}
+
+// Copy a rectangle one byte at a time as reference
+void
+reference_copy(uint8_t* dst, size_t dst_row_pitch, size_t dst_slice_pitch,
+               const uint8_t* src, size_t src_row_pitch, size_t src_slice_pitch,
+               const size_t* region)
+{
+  for (size_t z = 0; z < region[2]; ++z)
+    for (size_t y = 0; y < region[1]; ++y)
+      for (size_t x = 0; x < region[0]; ++x)
+        dst[z * dst_slice_pitch + y * dst_row_pitch + x] = src[z * src_slice_pitch + y * src_row_pitch + x];
+}
+
+struct layout
+{
+  size_t row_pitch;
+  size_t slice_pitch;
+};
+
+// Copy region from src layout to dst layout with copy_rect and with
+// the reference copy, and compare the entire destination buffers
+void
+check_copy(const size_t* region, layout src, layout dst)
+{
+  auto src_size = (region[2] - 1) * src.slice_pitch + (region[1] - 1) * src.row_pitch + region[0];
+  auto dst_size = (region[2] - 1) * dst.slice_pitch + (region[1] - 1) * dst.row_pitch + region[0];
+  auto src_buf = pattern(src_size);
+  std::vector<uint8_t> expected(dst_size, 0xff);
+  std::vector<uint8_t> actual(dst_size, 0xff);
+
+  reference_copy(expected.data(), dst.row_pitch, dst.slice_pitch,
+                 src_buf.data(), src.row_pitch, src.slice_pitch, region);
+  xrt_core::copy_rect(actual.data(), dst.row_pitch, dst.slice_pitch,
+                      src_buf.data(), src.row_pitch, src.slice_pitch, region);
+  EXPECT_EQ(expected, actual);
+}
+
+} // namespace
+
+TEST(RectByteRange, Contiguous)
+{
+  size_t origin[3] = {0, 0, 0};
+  size_t region[3] = {64, 4, 2};
+  auto range = xrt_core::rect_byte_range(origin, region, 64, 256);
+  EXPECT_EQ(range.offset, 0u);
+  EXPECT_EQ(range.size, 512u);
+}
+
+TEST(RectByteRange, Strided)
+{
+  size_t origin[3] = {3, 2, 1};
+  size_t region[3] = {10, 3, 2};
+  size_t row_pitch = 32;
+  size_t slice_pitch = 1024;
+  auto range = xrt_core::rect_byte_range(origin, region, row_pitch, slice_pitch);
+  EXPECT_EQ(range.offset, 1 * slice_pitch + 2 * row_pitch + 3);
+
+  // From first byte of first row of first slice through last byte of
+  // last row of last slice
+  EXPECT_EQ(range.size, 1 * slice_pitch + 2 * row_pitch + 10);
+}
+
+TEST(RectByteRange, EmptyRegion)
+{
+  size_t origin[3] = {1, 1, 1};
+  for (size_t dim = 0; dim < 3; ++dim) {
+    size_t region[3] = {8, 8, 8};
+    region[dim] = 0;
+    auto range = xrt_core::rect_byte_range(origin, region, 16, 256);
+    EXPECT_EQ(range.size, 0u) << "dimension " << dim;
+  }
+}
+
+TEST(SetDefaultRectPitches, Zero)
+{
+  size_t region[3] = {10, 4, 3};
+  size_t row_pitch = 0;
+  size_t slice_pitch = 0;
+  xrt_core::set_default_rect_pitches(row_pitch, slice_pitch, region);
+  EXPECT_EQ(row_pitch, 10u);
+  EXPECT_EQ(slice_pitch, 40u);
+
+  row_pitch = 16;
+  slice_pitch = 0;
+  xrt_core::set_default_rect_pitches(row_pitch, slice_pitch, region);
+  EXPECT_EQ(row_pitch, 16u);
+  EXPECT_EQ(slice_pitch, 64u);
+}
+
+TEST(SetDefaultRectPitches, NonZero)
+{
+  size_t region[3] = {10, 4, 3};
+  size_t row_pitch = 12;
+  size_t slice_pitch = 100;
+  xrt_core::set_default_rect_pitches(row_pitch, slice_pitch, region);
+  EXPECT_EQ(row_pitch, 12u);
+  EXPECT_EQ(slice_pitch, 100u);
+}
+
+TEST(CopyRect, Contiguous)
+{
+  // Rows and slices are merged into a single memcpy
+  size_t region[3] = {16, 8, 4};
+  check_copy(region, {16, 128}, {16, 128});
+}
+
+TEST(CopyRect, ContiguousRows)
+{
+  // Rows are merged, slices are not
+  size_t region[3] = {16, 8, 4};
+  check_copy(region, {16, 200}, {16, 160});
+}
+
+TEST(CopyRect, Strided)
+{
+  size_t region[3] = {7, 5, 3};
+  check_copy(region, {13, 80}, {9, 50});
+  check_copy(region, {7, 35}, {20, 120});
+}
+
+TEST(CopyRect, SingleRow)
+{
+  size_t region[3] = {33, 1, 1};
+  check_copy(region, {40, 40}, {64, 64});
+}
+
+TEST(CopyRect, EmptyRegion)
+{
+  std::vector<uint8_t> src = pattern(64);
+  std::vector<uint8_t> dst(64, 0xff);
+  size_t region[3] = {8, 0, 2};
+  xrt_core::copy_rect(dst.data(), 8, 64, src.data(), 8, 64, region);
+  EXPECT_EQ(dst, std::vector<uint8_t>(64, 0xff));
+}
+
+TEST(CopyRect, Parallel)
+{
+  // Large enough to be split over worker threads when the host has
+  // more than one core, with a row count that does not divide evenly
+  size_t region[3] = {4093, 1031, 2};
+  check_copy(region, {4096, 4096 * 1031}, {4100, 4100 * 1040});
+}
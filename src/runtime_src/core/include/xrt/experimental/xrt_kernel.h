@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2021 Xilinx, Inc. All rights reserved.
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 #ifndef XRT_EXPERIMENTAL_KERNEL_H
 #define XRT_EXPERIMENTAL_KERNEL_H
 #include "xrt/xrt_kernel.h"
@@ -274,6 +274,211 @@ public:
   reset();
 };
 
+/**
+ * @enum run_wait_policy - Policy for waiting on run completion
+ *
+ * @var block
+ *  Block the waiting thread until the run completes.  This is the
+ *  default policy.
+ * @var hybrid
+ *  Poll the run state before blocking.  The time spent polling is
+ *  adapted to recent completion times of the run and is bounded by
+ *  xrt.ini ``Runtime.run_wait_spin_us``.  Runs that take longer
+ *  than the bound are not polled.  This policy trades CPU cycles for
+ *  lower wait latency of short running kernels.
+ */
+enum class run_wait_policy { block, hybrid };
+
+/**
+ * set_run_wait_policy() - Set policy used by xrt::run::wait() and wait2()
+ *
+ * @param run
+ *  Run object to set the wait policy for
+ * @param policy
+ *  Policy for waiting on completion of the run
+ *
+ * The default policy of a run is specified by xrt.ini
+ * ``Runtime.run_wait_policy`` which is either "block" or "hybrid".
+ */
+XRT_API_EXPORT
+void
+set_run_wait_policy(const xrt::run& run, run_wait_policy policy);
+
+/**
+ * class rungraph - A class to manage a graph of xrt::run objects
+ *
+ * @brief
+ * This class is used to execute xrt::run objects in dependency order
+ * such that a run object is started only when all the run objects
+ * it depends on have completed.
+ *
+ * @details
+ * Run objects are added to the graph using the add() method along
+ * with the run objects they depend on.  The dependencies must
+ * already be part of the graph, which guarantees the graph is
+ * acyclic.  A run object can also depend on fences, which are waited
+ * on by the hw queue prior to starting the run object.
+ *
+ * When the graph is executed, all run objects without dependencies
+ * are started.  Dependent run objects are started from the completion
+ * path of the run objects they depend on, without involving the
+ * thread that executed the graph, such that independent branches of
+ * the graph execute concurrently.
+ *
+ * The graph relies on managed command execution, same as
+ * xrt::run::add_callback(), which is supported on Alveo style
+ * platforms only.
+ */
+class rungraph_impl;
+class rungraph : public detail::pimpl<rungraph_impl>
+{
+public:
+  /**
+   * rungraph() - Construct empty rungraph object
+   *
+   * Can be used as lvalue in assignment.
+   *
+   * It is undefined behavior to use a default constructed rungraph
+   * for anything but assignment.
+   */
+  rungraph() = default;
+
+  /**
+   * rungraph - Constructor
+   *
+   * A rungraph is associated with a specific hwctx.  All run objects
+   * added to the graph should be associated with kernel objects that
+   * are created in specified hwctx.
+   */
+  XRT_API_EXPORT
+  explicit
+  rungraph(const xrt::hw_context& hwctx);
+
+  /**
+   * rungraph - Destructor
+   *
+   * The destructor of the rungraph clears the association with the
+   * run objects, but does not check for rungraph state or wait for
+   * run object completion.  It is the caller's responsibility to
+   * ensure that the rungraph is not executing when the destructor is
+   * called.
+   */
+  XRT_API_EXPORT
+  ~rungraph();
+
+  /**
+   * add() - Add a run object to the graph
+   *
+   * @param run
+   *  Run object to add.  A run object can be added to a graph once.
+   * @param deps
+   *  Run objects that must complete before @run is started.  The run
+   *  objects must already be part of the graph.
+   *
+   * It is undefined behavior to explicitly start (xrt::run::start())
+   * or to add callbacks to a run object that is part of a rungraph.
+   *
+   * Throws if the run object is already part of the graph, if a
+   * dependency is not part of the graph, or if the rungraph is
+   * executing.
+   */
+  XRT_API_EXPORT
+  void
+  add(const xrt::run& run, const std::vector<xrt::run>& deps = {});
+
+  /**
+   * add() - Add a run object with fence dependencies to the graph
+   *
+   * @param run
+   *  Run object to add.
+   * @param deps
+   *  Run objects that must complete before @run is started.
+   * @param fences
+   *  Fences the hw queue must wait on prior to starting @run.
+   *
+   * Same behavior as add() without fences.  Fence dependencies
+   * require a device that supports xrt::run::submit_wait().
+   */
+  XRT_API_EXPORT
+  void
+  add(const xrt::run& run, const std::vector<xrt::run>& deps,
+      const std::vector<xrt::fence>& fences);
+
+  /**
+   * execute() - Execute the rungraph
+   *
+   * All run objects without dependencies are started.  The remaining
+   * run objects are started as their dependencies complete.
+   *
+   * Executing an empty rungraph is a no-op.
+   *
+   * Throws if rungraph is already executing.
+   */
+  XRT_API_EXPORT
+  void
+  execute();
+
+  /**
+   * wait() - Wait for the rungraph to complete
+   *
+   * @param timeout
+   *  Timeout for wait.  A value of 0, implies block until all run
+   *  objects have completed.
+   * @return
+   *  std::cv_status::no_timeout if all run objects have completed,
+   *  std::cv_status::timeout if the timeout expired prior to all run
+   *  objects completing.
+   *
+   * If any run object fails to complete successfully, run objects
+   * that depend on it, directly or indirectly, are not started.  The
+   * function throws `xrt::runlist::command_error` with the first
+   * failed run object and its state once all started run objects
+   * have completed.
+   */
+  XRT_API_EXPORT
+  std::cv_status
+  wait(const std::chrono::milliseconds& timeout) const;
+
+  /**
+   * wait() - Wait for the rungraph to complete
+   *
+   * This is a convenience method that calls wait() with a timeout of 0.
+   */
+  void
+  wait() const
+  {
+    wait(std::chrono::milliseconds(0));
+  }
+
+  /**
+   * state() - Check the current state of a rungraph object
+   *
+   * @return
+   *  ERT_CMD_STATE_RUNNING while run objects are executing,
+   *  ERT_CMD_STATE_COMPLETED when all run objects have completed
+   *  successfully, or the state of the first failed run object.
+   *
+   * The state of a finished execution is retained until the rungraph
+   * is executed again or reset, also after wait() has thrown the
+   * error of a failed execution.  The state of an empty rungraph is
+   * ERT_CMD_STATE_COMPLETED.
+   */
+  XRT_API_EXPORT
+  ert_cmd_state
+  state() const;
+
+  /**
+   * reset() - Reset the rungraph
+   *
+   * All run objects are removed from the graph.
+   *
+   * Throws if rungraph is executing.
+   */
+  XRT_API_EXPORT
+  void
+  reset();
+};
+
 } // namespace xrt
 
 #endif // __cplusplus
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2020-2022 Xilinx, Inc.  All rights reserved.
-// Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2023-2026 Advanced Micro Devices, Inc. All rights reserved.
 #ifndef XRT_XCLBIN_H_
 #define XRT_XCLBIN_H_
 
@@ -987,6 +987,39 @@ public:
   XRT_API_EXPORT
   xclbin
   load(const std::string& name) const;
+
+  /**
+   * load_by_uuid() - Load xclbin with specified uuid from repository
+   *
+   * @param xid
+   *  UUID of xclbin to load
+   * @return
+   *  The xclbin with matching uuid, throws if no such xclbin
+   *
+   * The first lookup builds an index of the repository by reading
+   * the headers of the xclbin files.  With xrt.ini
+   * ``Runtime.xclbin_repository_cache`` enabled, the index is also
+   * cached on disk and revalidated against file size and modification
+   * time, such that lookups from later processes do not read
+   * unchanged xclbin files.
+   */
+  XRT_API_EXPORT
+  xclbin
+  load_by_uuid(const uuid& xid) const;
+
+  /**
+   * find_by_kernel() - Find xclbins in repository with kernel
+   *
+   * @param name
+   *  Name of kernel
+   * @return
+   *  Paths to the xclbin files with specified kernel, empty if none
+   *
+   * Uses the same index as load_by_uuid().
+   */
+  XRT_API_EXPORT
+  std::vector<std::string>
+  find_by_kernel(const std::string& name) const;
 };
 
 } // namespace xrt
@@ -288,10 +288,13 @@ static std::vector<std::shared_ptr<pl::device>> s_devices;
 // Command handles are added to a producer/consumer queue A worker
 // thread pretends to run the command and marks it complete only if
 // the command was enqueue some constant time before now.
+//
+// The queue is the bounded lock-free variant since commands are
+// submitted from arbitrarily many host threads.
 namespace cmd {
 
 static unsigned int completion_delay_us = 0;
-static xrt_core::task::queue running_queue;
+static xrt_core::task::bounded_queue running_queue;
 static std::thread completer;
 static std::atomic<uint64_t> completion_count {0};
 
@@ -308,7 +311,7 @@ static void
 init()
 {
   if ( (completion_delay_us = xrt_core::config::get_noop_completion_delay_us()) )
-    completer = std::move(xrt_core::thread(xrt_core::task::worker, std::ref(running_queue)));
+    completer = std::move(xrt_core::thread(xrt_core::task::bounded_worker, std::ref(running_queue)));
 }
 
 static void
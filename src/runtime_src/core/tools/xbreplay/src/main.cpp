@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #include "seq_reconstructor.hpp"
 #include "utils/cmd_args.hpp"
@@ -10,13 +10,30 @@
 namespace {
 namespace xbr = xrt_core::tools::xbreplay;
 
+/*
+ * This function is used to parse the replay mode
+ */
+static xbr::replay_mode parse_replay_mode(const std::string& mode)
+{
+  if (mode == "seq")
+    return xbr::replay_mode::sequential;
+  if (mode == "timed")
+    return xbr::replay_mode::timed;
+  if (mode == "afap")
+    return xbr::replay_mode::afap;
+  throw std::runtime_error("Unknown replay mode: " + mode);
+}
+
 /*
  * This function is used to parse the command line arguments
  */
-static std::tuple<bool, std::string, std::string> parse_command_line_arguments(std::vector<std::string>& cmd_params)
+static std::tuple<bool, std::string, std::string, unsigned int, xbr::replay_options>
+parse_command_line_arguments(std::vector<std::string>& cmd_params)
 {
   std::string trace_file;
   std::string mem_file;
+  unsigned int parse_threads = 1;
+  xbr::replay_options opts;
   std::vector<std::string>& args = cmd_params;
   xbr::utils::cmd_args_opt opt;
   bool doexit = false;
@@ -25,12 +42,15 @@ static std::tuple<bool, std::string, std::string> parse_command_line_arguments(s
     {'h', false, "", "To provide usage information"},
     {'t', true, "", "To provide path to the trace file as input"},
     {'d', true, "", "To provide path to the memory dump file"},
-    {'l', true, "", "To set the log level (DEBUG=0, INFO=1, WARN=2, ERROR=3)"}
+    {'l', true, "", "To set the log level (DEBUG=0, INFO=1, WARN=2, ERROR=3)"},
+    {'j', true, "", "To set the number of threads parsing the trace file"},
+    {'m', true, "", "To set the replay mode (seq, timed, afap), timed and afap report latency per API"},
+    {'x', true, "", "To set the speedup factor of timed replay mode"}
   };
 
   xbr::utils::cmd_args cargs(std::move(options));
 
-  while (-1 != cargs.parse(args, opt, "t:d:l:h"))
+  while (-1 != cargs.parse(args, opt, "t:d:l:j:m:x:h"))
   {
     switch (opt.type)
     {
@@ -50,18 +70,33 @@ static std::tuple<bool, std::string, std::string> parse_command_line_arguments(s
         l.set_loglevel(opt.value);
         XBREPLAY_INFO("Received log level: ", opt.value);
         break;
+      case 'j':
+        parse_threads = static_cast<unsigned int>(std::stoul(opt.value));
+        XBREPLAY_INFO("Trace parse threads: ", opt.value);
+        break;
+      case 'm':
+        opts.mode = parse_replay_mode(opt.value);
+        XBREPLAY_INFO("Replay mode: ", opt.value);
+        break;
+      case 'x':
+        opts.speedup = std::stod(opt.value);
+        if (opts.speedup <= 0)
+          throw std::runtime_error("Invalid speedup factor: " + opt.value);
+        XBREPLAY_INFO("Replay speedup factor: ", opt.value);
+        break;
       default:
         throw std::runtime_error("Unknown option or missing argument. ABORT !!");
         break;
     }
   }
-  return std::make_tuple(doexit, trace_file, mem_file);
+  return std::make_tuple(doexit, trace_file, mem_file, parse_threads, opts);
 }
 
 /*
  * This function is used to start the replay
  */
-static void start_replay(const std::string& trace_file, const std::string& mem_file)
+static void start_replay(const std::string& trace_file, const std::string& mem_file,
+                         unsigned int parse_threads, const xbr::replay_options& opts)
 {
   xbr::seq_reconstructor_factory seq_factory = {};
 
@@ -71,7 +106,7 @@ static void start_replay(const std::string& trace_file, const std::string& mem_f
     *      -> Replay Master Thread.
     *         -> Replay Worker Thread.
     */
-  if (auto pseq_recon = seq_factory.create_seq_recon(trace_file, mem_file))
+  if (auto pseq_recon = seq_factory.create_seq_recon(trace_file, mem_file, parse_threads, opts))
      pseq_recon->threads_join();
   else
       throw std::runtime_error("Failed to create sequence reconstructor");
@@ -90,8 +125,10 @@ int main(int argc, const char* argv[])
     /* doexit - Flag to indicate if the program should exit
      * trace_file & mem_file - Input Trace file path & memory dump file path
      * which is generated by xbtracer.
+     * parse_threads - Number of threads parsing the trace file.
+     * opts - Replay mode and speedup factor.
      */
-    auto [doexit, trace_file, mem_file] = parse_command_line_arguments(args);
+    auto [doexit, trace_file, mem_file, parse_threads, opts] = parse_command_line_arguments(args);
 
     /* The user has executed the 'xbreplay' command with the '-h' option.
      * The help message has been displayed on the screen. The program will now terminate.
@@ -99,7 +136,7 @@ int main(int argc, const char* argv[])
     if (doexit)
       return 0;
 
-    start_replay(trace_file, mem_file);
+    start_replay(trace_file, mem_file, parse_threads, opts);
   }
   catch (const std::exception& e)
   {
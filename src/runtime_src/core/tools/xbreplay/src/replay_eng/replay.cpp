@@ -1,8 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #include "replay.hpp"
 
+#include <algorithm>
+#include <iostream>
+
 namespace xrt_core::tools::xbreplay {
 
 
@@ -39,6 +42,70 @@ void replay_master::replay_master_main()
   XBREPLAY_INFO("Replay Master Exited");
 }
 
+/**
+ * Delay the call until its scheduled start in timed mode.  The first call
+ * of a thread is scheduled at its recorded offset from the start of the
+ * trace, subsequent calls at their recorded gap from the previous call of
+ * the same thread.  Offsets and gaps are divided by the speedup factor.
+ * A call that cannot start on time starts immediately and its lag is
+ * recorded.
+ */
+void replay_worker::pace(const std::shared_ptr<utils::message>& msg)
+{
+  if (m_opts.mode != replay_mode::timed)
+    return;
+
+  auto scaled = [this](uint64_t from_ns, uint64_t to_ns)
+  {
+    auto gap = static_cast<double>(to_ns > from_ns ? to_ns - from_ns : 0) / m_opts.speedup;
+    return std::chrono::duration_cast<clock::duration>(std::chrono::duration<double, std::nano>(gap));
+  };
+
+  auto now = clock::now();
+  auto it = m_thread_pace.find(msg->m_tid);
+  auto target = (it == m_thread_pace.end())
+    ? m_replay_start + scaled(m_trace_start_ns, msg->m_entry_ns)
+    : it->second.start + scaled(it->second.entry_ns, msg->m_entry_ns);
+
+  uint64_t lag_ns = 0;
+  if (target > now)
+  {
+    std::this_thread::sleep_until(target);
+    now = clock::now();
+  }
+  else
+    lag_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now - target).count();
+
+  m_stats.add_lag(lag_ns);
+  m_thread_pace[msg->m_tid] = {msg->m_entry_ns, now};
+}
+
+/**
+ * Invoke the API and, except in sequential mode, collect its replayed and
+ * recorded latency.
+ */
+void replay_worker::invoke(const std::shared_ptr<utils::message>& msg)
+{
+  if (m_opts.mode == replay_mode::sequential)
+  {
+    m_api.invoke(msg);
+    return;
+  }
+
+  auto start = clock::now();
+  auto mapped = m_api.invoke(msg);
+  auto end = clock::now();
+  if (!mapped)
+    return;
+
+  uint64_t recorded_ns = 0;
+  if (msg->m_exit_ns && msg->m_exit_ns >= msg->m_entry_ns)
+    recorded_ns = std::max<uint64_t>(1, msg->m_exit_ns - msg->m_entry_ns);
+
+  auto replayed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  m_stats.add_call(msg->m_api_id, recorded_ns, replayed_ns);
+}
+
 /**
  * This is replay worker thread function.
  * Receives instructions from Replay master thread to
@@ -47,14 +114,23 @@ void replay_master::replay_master_main()
 void replay_worker::replay_worker_main()
 {
   XBREPLAY_INFO("Replay Worker started");
+  bool first = true;
   while (true)
   {
     auto msg = m_in_msgq.receive();
     if (msg->get_msgtype() != utils::message_type::stop_replay)
     {
+      if (first)
+      {
+        m_replay_start = clock::now();
+        m_trace_start_ns = msg->m_entry_ns;
+        first = false;
+      }
+
       try
       {
-        m_api.invoke(msg);
+        pace(msg);
+        invoke(msg);
       }
       catch (const std::exception& e)
       {
@@ -73,6 +149,14 @@ void replay_worker::replay_worker_main()
     }
   }
   m_api.clear_map();
+
+  if (m_opts.mode != replay_mode::sequential)
+  {
+    if (!first)
+      m_stats.set_replay_time(std::chrono::duration_cast<std::chrono::nanoseconds>
+                              (clock::now() - m_replay_start).count());
+    m_stats.print(std::cout);
+  }
   XBREPLAY_INFO("Replay Worker Exited");
 }
 
@@ -1,29 +1,82 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
+#include "replay_stats.hpp"
 #include "replay_xrt.hpp"
 #include "utils/message_queue.hpp"
 
+#include <chrono>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace xrt_core::tools::xbreplay {
 
+/**
+ * Replay modes
+ *  sequential - API calls are replayed back to back, no report
+ *  timed      - API calls are replayed at the recorded pace, the recorded
+ *               gap between two calls of a thread is honoured, divided by
+ *               the speedup factor
+ *  afap       - API calls are replayed back to back as fast as possible
+ * Timed and afap modes print a report of replayed-vs-recorded latency per
+ * API at the end of replay.
+ */
+enum class replay_mode {
+  sequential = 0,
+  timed,
+  afap
+};
+
+struct replay_options
+{
+  replay_mode mode = replay_mode::sequential;
+  double speedup = 1.0;
+};
+
 /**
  * Replay worker class
  */
 class replay_worker
 {
+  using clock = std::chrono::steady_clock;
+
+  /* Recorded Entry time and replayed start time of the last call of a thread */
+  struct thread_pace
+  {
+    uint64_t entry_ns;
+    clock::time_point start;
+  };
+
   utils::message_queue& m_in_msgq;
   std::thread m_replay_thrd;
   replay_xrt m_api;
+  replay_options m_opts;
+  replay_stats m_stats;
+
+  /* Map between TID from trace log and its pace */
+  std::unordered_map<uint64_t, thread_pace> m_thread_pace;
+  clock::time_point m_replay_start;
+  uint64_t m_trace_start_ns = 0;
+
+  /*
+   * This function is used to delay a call until its scheduled start
+   * in timed mode.
+   */
+  void pace(const std::shared_ptr<utils::message>& msg);
+
+  /*
+   * This function is used to invoke an API and collect its latency.
+   */
+  void invoke(const std::shared_ptr<utils::message>& msg);
 
   public:
-  replay_worker(utils::message_queue& mqueues)
+  replay_worker(utils::message_queue& mqueues, const replay_options& opts)
   :m_in_msgq(mqueues)
+  ,m_opts(opts)
   {}
 
   void replay_worker_main();
@@ -82,9 +135,9 @@ class replay_master
   }
 
   public:
-  replay_master(utils::message_queue& msg_q)
+  replay_master(utils::message_queue& msg_q, const replay_options& opts)
   : m_in_msgq(msg_q)
-  , m_replay_worker(m_out_msgq)
+  , m_replay_worker(m_out_msgq, opts)
   {
     m_api_skip_flag_cnt = 0;
     init_api_skip_list();
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+#include "replay_stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+
+namespace xrt_core::tools::xbreplay {
+
+namespace {
+
+constexpr double ns_per_us = 1000.0;
+constexpr double ns_per_ms = 1000000.0;
+
+struct summary
+{
+  double mean_us = 0;
+  double p50_us = 0;
+  double p99_us = 0;
+};
+
+/*
+ * Mean and nearest rank percentiles of samples in us.
+ */
+summary summarize(std::vector<uint64_t> samples)
+{
+  summary sum;
+  if (samples.empty())
+    return sum;
+
+  std::sort(samples.begin(), samples.end());
+  auto rank = [&samples](double pct)
+  {
+    auto idx = static_cast<size_t>(std::ceil(pct * samples.size()));
+    return static_cast<double>(samples[std::max<size_t>(idx, 1) - 1]) / ns_per_us;
+  };
+
+  auto total = std::accumulate(samples.begin(), samples.end(), 0.0);
+  sum.mean_us = total / samples.size() / ns_per_us;
+  sum.p50_us = rank(0.50);
+  sum.p99_us = rank(0.99);
+  return sum;
+}
+
+} // namespace
+
+void replay_stats::add_call(const std::string& api_id, uint64_t recorded_ns, uint64_t replayed_ns)
+{
+  auto& api = m_apis[api_id];
+  if (recorded_ns)
+    api.recorded_ns.push_back(recorded_ns);
+  api.replayed_ns.push_back(replayed_ns);
+}
+
+void replay_stats::add_lag(uint64_t lag_ns)
+{
+  ++m_paced_calls;
+  if (!lag_ns)
+    return;
+
+  ++m_late_calls;
+  m_total_lag_ns += lag_ns;
+  m_max_lag_ns = std::max(m_max_lag_ns, lag_ns);
+}
+
+void replay_stats::print(std::ostream& ostr) const
+{
+  uint64_t calls = 0;
+  for (const auto& api : m_apis)
+    calls += api.second.replayed_ns.size();
+
+  auto flags = ostr.flags();
+  auto precision = ostr.precision();
+  ostr << std::fixed << std::setprecision(1);
+  ostr << "Replay report: " << calls << " calls in "
+       << static_cast<double>(m_replay_ns) / ns_per_ms << " ms\n";
+
+  if (m_paced_calls)
+  {
+    auto mean_lag = m_late_calls ? static_cast<double>(m_total_lag_ns) / m_late_calls : 0.0;
+    ostr << "Paced calls: " << m_paced_calls << ", started late: " << m_late_calls
+         << ", mean lag: " << mean_lag / ns_per_us << " us"
+         << ", max lag: " << static_cast<double>(m_max_lag_ns) / ns_per_us << " us\n";
+  }
+
+  constexpr int wcnt = 8;
+  constexpr int wval = 11;
+  ostr << std::setw(wcnt) << "calls"
+       << std::setw(wval) << "rec mean" << std::setw(wval) << "rec p50" << std::setw(wval) << "rec p99"
+       << std::setw(wval) << "rep mean" << std::setw(wval) << "rep p50" << std::setw(wval) << "rep p99"
+       << std::setw(wcnt) << "rep/rec" << "  API (latency in us)\n";
+
+  for (const auto& [api_id, samples] : m_apis)
+  {
+    auto rec = summarize(samples.recorded_ns);
+    auto rep = summarize(samples.replayed_ns);
+    ostr << std::setw(wcnt) << samples.replayed_ns.size();
+    if (samples.recorded_ns.empty())
+      ostr << std::setw(wval) << "-" << std::setw(wval) << "-" << std::setw(wval) << "-";
+    else
+      ostr << std::setw(wval) << rec.mean_us << std::setw(wval) << rec.p50_us << std::setw(wval) << rec.p99_us;
+    ostr << std::setw(wval) << rep.mean_us << std::setw(wval) << rep.p50_us << std::setw(wval) << rep.p99_us;
+    if (rec.mean_us > 0)
+      ostr << std::setw(wcnt) << std::setprecision(2) << rep.mean_us / rec.mean_us << std::setprecision(1);
+    else
+      ostr << std::setw(wcnt) << "-";
+    ostr << "  " << api_id << "\n";
+  }
+  ostr.flags(flags);
+  ostr.precision(precision);
+}
+
+}// end of namespace
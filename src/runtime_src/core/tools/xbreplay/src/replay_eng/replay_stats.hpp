@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace xrt_core::tools::xbreplay {
+
+/**
+ * Replay statistics
+ *
+ * Collects the recorded latency (Exit marker time - Entry marker time)
+ * and the replayed latency of each replayed API call, and the start lag
+ * of paced calls, for a summary report per API.
+ */
+class replay_stats
+{
+  struct api_samples
+  {
+    std::vector<uint64_t> recorded_ns;
+    std::vector<uint64_t> replayed_ns;
+  };
+
+  std::map<std::string, api_samples> m_apis;
+  uint64_t m_paced_calls = 0;
+  uint64_t m_late_calls = 0;
+  uint64_t m_total_lag_ns = 0;
+  uint64_t m_max_lag_ns = 0;
+  uint64_t m_replay_ns = 0;
+
+  public:
+  /*
+   * Add the latencies of a replayed API call.  A recorded latency of
+   * zero means the call had no matching Exit marker line.
+   */
+  void add_call(const std::string& api_id, uint64_t recorded_ns, uint64_t replayed_ns);
+
+  /*
+   * Add the lag of a paced API call, the time the call started after
+   * its scheduled start.
+   */
+  void add_lag(uint64_t lag_ns);
+
+  /*
+   * Set the wall clock duration of the replay.
+   */
+  void set_replay_time(uint64_t replay_ns)
+  {
+    m_replay_ns = replay_ns;
+  }
+
+  /*
+   * Print replayed-vs-recorded latency per API.
+   */
+  void print(std::ostream& ostr) const;
+};
+
+}// end of namespace
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -141,19 +141,22 @@ class replay_xrt
   /*
    * This method will invoke the API received from
    * Replay Worker thread if it is registered.
+   * Returns false if the API is not registered.
    */
-  void invoke (std::shared_ptr<utils::message> msg)
+  bool invoke (std::shared_ptr<utils::message> msg)
   {
     if (m_api_map.find (msg->m_api_id) != m_api_map.end ())
     {
       msg->print_args();
       m_api_map[msg->m_api_id] (msg);
+      return true;
     }
     else
     {
       XBREPLAY_WARN("===================================================");
       XBREPLAY_WARN("No API MAPPED FOR:|", msg->m_api_id,"|");
       msg.reset();
+      return false;
     }
   }
 
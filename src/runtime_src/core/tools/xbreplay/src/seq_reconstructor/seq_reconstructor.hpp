@@ -1,9 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include "replay.hpp"
+#include "trace_parser.hpp"
 #include "utils/message_queue.hpp"
 
 #include <fstream>
@@ -20,7 +21,6 @@ namespace xrt_core::tools::xbreplay {
 class seq_reconstructor
 {
   protected:
-  std::ifstream m_trace_file;
   std::ifstream m_mem_dmp_file;
   std::thread m_seq_recon_thread;
   virtual ~seq_reconstructor() {}
@@ -38,6 +38,8 @@ class xrt_seq_reconstructor : public seq_reconstructor
   private:
   utils::message_queue m_msgq;
   replay_master m_replay_master;
+  std::unique_ptr<mapped_trace> m_trace;
+  unsigned int m_parse_threads;
 
   public:
   bool m_is_mem_file_available;
@@ -53,14 +55,13 @@ class xrt_seq_reconstructor : public seq_reconstructor
 
   /* constructor */
   xrt_seq_reconstructor(const std::string &trace_file_path,
-                        const std::string &mem_dmp_file_path)
-      : m_replay_master(m_msgq)
+                        const std::string &mem_dmp_file_path,
+                        unsigned int parse_threads,
+                        const replay_options &opts)
+      : m_replay_master(m_msgq, opts)
+      , m_trace(std::make_unique<mapped_trace>(trace_file_path))
+      , m_parse_threads(parse_threads)
   {
-    m_trace_file.open(trace_file_path.c_str());
-
-    if (!m_trace_file.is_open())
-      throw std::runtime_error("Failed to open input file: " + trace_file_path);
-
     if (!mem_dmp_file_path.empty())
     {
       m_mem_dmp_file.open(trace_file_path.c_str(), std::ios::binary);
@@ -100,9 +101,12 @@ class seq_reconstructor_factory
   public:
   std::shared_ptr<seq_reconstructor>
   create_seq_recon(const std::string &tracer_file,
-                   const std::string &dump_file)
+                   const std::string &dump_file,
+                   unsigned int parse_threads = 1,
+                   const replay_options &opts = {})
   {
-    return std::make_shared<xrt_seq_reconstructor>(tracer_file, dump_file);
+    return std::make_shared<xrt_seq_reconstructor>(tracer_file, dump_file,
+                                                   parse_threads, opts);
   }
 };
 
@@ -0,0 +1,295 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+#include "trace_parser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+#ifndef _WIN32
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace xrt_core::tools::xbreplay {
+
+namespace {
+
+constexpr std::string_view entry_tag = "|ENTRY|";
+constexpr std::string_view exit_tag = "|EXIT|";
+
+/*
+ * A tokenized Entry or Exit marker line.  The attributes used to match
+ * an Entry marker line with its Exit marker line, TID, object handle and
+ * API ID (function signature), are kept as consecutive fields of the
+ * line to keep markers small.
+ */
+struct marker
+{
+  std::string_view line;
+  std::string_view match;  // matching Exit marker line of an Entry marker
+  uint32_t tid_hash = 0;
+  uint32_t tid_pos = 0;
+  uint32_t tid_len = 0;
+  uint32_t handle_len = 0;
+  uint32_t api_len = 0;
+  bool entry = false;
+
+  std::string_view tid() const
+  {
+    return line.substr(tid_pos, tid_len);
+  }
+
+  std::string_view handle() const
+  {
+    return line.substr(tid_pos + tid_len + 1, handle_len);
+  }
+
+  std::string_view api_id() const
+  {
+    return line.substr(tid_pos + tid_len + handle_len + 2, api_len);
+  }
+};
+
+bool starts_with(std::string_view str, std::string_view prefix)
+{
+  return str.substr(0, prefix.size()) == prefix;
+}
+
+/*
+ * Marker lines are of the form
+ *  |ENTRY|<time>|<pid>|<tid>|<handle>|<api>(<args>)|
+ *  |EXIT|<time>|<pid>|<tid>|<handle>|<api>[=<ret>]|<args>|
+ * The API ID is the API up to and including its first ')'.  Fields of a
+ * malformed marker line are left empty.
+ */
+bool tokenize(std::string_view line, marker& mkr)
+{
+  size_t pos = 0;
+  if (starts_with(line, entry_tag))
+  {
+    mkr.entry = true;
+    pos = entry_tag.size();
+  }
+  else if (starts_with(line, exit_tag))
+  {
+    mkr.entry = false;
+    pos = exit_tag.size();
+  }
+  else
+    return false;
+
+  mkr.line = line;
+
+  // time, pid, tid, handle, api
+  std::array<size_t, 6> delims;
+  delims[0] = pos - 1;
+  for (size_t idx = 1; idx < delims.size(); ++idx)
+  {
+    delims[idx] = line.find('|', delims[idx - 1] + 1);
+    if (delims[idx] == std::string_view::npos)
+      return true;
+  }
+
+  auto api = line.substr(delims[4] + 1, delims[5] - delims[4] - 1);
+  auto paren = api.find(')');
+  mkr.tid_pos = static_cast<uint32_t>(delims[2] + 1);
+  mkr.tid_len = static_cast<uint32_t>(delims[3] - delims[2] - 1);
+  mkr.handle_len = static_cast<uint32_t>(delims[4] - delims[3] - 1);
+  mkr.api_len = (paren == std::string_view::npos) ? 0 : static_cast<uint32_t>(paren + 1);
+
+  mkr.tid_hash = static_cast<uint32_t>(std::hash<std::string_view>{}(mkr.tid()));
+  return true;
+}
+
+/*
+ * Tokenize all marker lines of a chunk of whole lines.
+ */
+std::vector<marker> tokenize_chunk(std::string_view chunk)
+{
+  // Reserve for short lines, memory never touched is not committed
+  std::vector<marker> markers;
+  markers.reserve(chunk.size() / 32);
+  size_t pos = 0;
+  while (pos < chunk.size())
+  {
+    auto end = chunk.find('\n', pos);
+    if (end == std::string_view::npos)
+      end = chunk.size();
+
+    auto line = chunk.substr(pos, end - pos);
+    if (!line.empty() && line.back() == '\r')
+      line.remove_suffix(1);
+
+    marker mkr;
+    if (tokenize(line, mkr))
+      markers.push_back(mkr);
+
+    pos = end + 1;
+  }
+  return markers;
+}
+
+/*
+ * Split trace in at most 'count' chunks of whole lines.
+ */
+std::vector<std::string_view> split_lines(std::string_view trace, size_t count)
+{
+  std::vector<std::string_view> chunks;
+  size_t begin = 0;
+  for (size_t i = 1; i <= count && begin < trace.size(); ++i)
+  {
+    size_t end = trace.size();
+    if (i < count)
+    {
+      end = trace.find('\n', std::max(begin, trace.size() * i / count));
+      end = (end == std::string_view::npos) ? trace.size() : end + 1;
+    }
+    chunks.push_back(trace.substr(begin, end - begin));
+    begin = end;
+  }
+  return chunks;
+}
+
+/*
+ * Match Entry markers with Exit markers in file order.  Only markers
+ * with TID hash in partition 'part' of 'nparts' are matched.
+ *
+ * Calls made by one thread are nested, so the pending Entry markers of
+ * a thread form a stack and an Exit marker matches the most recent
+ * pending Entry marker with same object handle and API ID.  Pending
+ * Entry markers above the matched one are calls whose Exit marker is
+ * missing from the trace; they are left unmatched.
+ */
+void match_markers(std::vector<std::vector<marker>>& chunks, size_t part, size_t nparts)
+{
+  std::unordered_map<std::string_view, std::vector<marker*>> pending;
+  for (auto& chunk : chunks)
+  {
+    for (auto& mkr : chunk)
+    {
+      if (mkr.tid_hash % nparts != part)
+        continue;
+
+      auto& stack = pending[mkr.tid()];
+      if (mkr.entry)
+      {
+        stack.push_back(&mkr);
+        continue;
+      }
+
+      auto itr = std::find_if(stack.rbegin(), stack.rend(), [&mkr](const marker* entry) {
+        return entry->handle() == mkr.handle() && entry->api_id() == mkr.api_id();
+      });
+      if (itr == stack.rend())
+        continue;
+
+      (*itr)->match = mkr.line;
+      stack.erase(std::prev(itr.base()), stack.end());
+    }
+  }
+}
+
+template <typename Function>
+void run_parallel(size_t count, Function&& fn)
+{
+  if (count == 1)
+  {
+    fn(0);
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  threads.reserve(count);
+  for (size_t idx = 0; idx < count; ++idx)
+    threads.emplace_back(fn, idx);
+  for (auto& thread : threads)
+    thread.join();
+}
+
+} // namespace
+
+mapped_trace::
+mapped_trace(const std::string& path)
+{
+#ifndef _WIN32
+  auto fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("Failed to open input file: " + path);
+
+  struct stat st = {};
+  if (::fstat(fd, &st) < 0)
+  {
+    ::close(fd);
+    throw std::runtime_error("Failed to stat input file: " + path);
+  }
+
+  m_size = static_cast<size_t>(st.st_size);
+  if (m_size)
+  {
+    auto addr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED)
+    {
+      ::madvise(addr, m_size, MADV_SEQUENTIAL);
+      m_data = static_cast<const char*>(addr);
+    }
+  }
+  ::close(fd);
+
+  if (m_data || !m_size)
+    return;
+#endif
+
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs)
+    throw std::runtime_error("Failed to open input file: " + path);
+
+  m_buffer.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+  m_data = m_buffer.data();
+  m_size = m_buffer.size();
+}
+
+mapped_trace::
+~mapped_trace()
+{
+#ifndef _WIN32
+  if (m_buffer.empty() && m_data)
+    ::munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
+
+std::vector<trace_call>
+trace_parser::
+parse(std::string_view trace, unsigned int nthreads)
+{
+  size_t count = std::max(1u, nthreads);
+
+  auto chunks = split_lines(trace, count);
+  std::vector<std::vector<marker>> markers(chunks.size());
+  run_parallel(chunks.size(), [&](size_t idx) { markers[idx] = tokenize_chunk(chunks[idx]); });
+  run_parallel(count, [&](size_t part) { match_markers(markers, part, count); });
+
+  size_t nmarkers = 0;
+  for (const auto& chunk : markers)
+    nmarkers += chunk.size();
+
+  std::vector<trace_call> calls;
+  calls.reserve(nmarkers);
+  for (const auto& chunk : markers)
+    for (const auto& mkr : chunk)
+      if (mkr.entry)
+        calls.push_back({mkr.line, mkr.match});
+
+  return calls;
+}
+
+} // namespace xrt_core::tools::xbreplay
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace xrt_core::tools::xbreplay {
+
+/**
+ * Read only view of a trace file.  The file is memory mapped where
+ * supported, otherwise read into memory.
+ */
+class mapped_trace
+{
+  const char* m_data = nullptr;
+  size_t m_size = 0;
+  std::string m_buffer;   // used when the file is not mapped
+
+  public:
+  explicit mapped_trace(const std::string& path);
+  ~mapped_trace();
+
+  mapped_trace(const mapped_trace&) = delete;
+  mapped_trace(mapped_trace&&) = delete;
+  mapped_trace& operator=(const mapped_trace&) = delete;
+  mapped_trace& operator=(mapped_trace&&) = delete;
+
+  std::string_view view() const
+  {
+    return {m_data, m_size};
+  }
+};
+
+/**
+ * An API call of the trace, the Entry marker line and the matching Exit
+ * marker line.  The exit line is empty if no matching Exit marker line
+ * was found.
+ */
+struct trace_call
+{
+  std::string_view entry;
+  std::string_view exit;
+};
+
+/**
+ * Trace parser
+ *
+ * Tokenizes the Entry and Exit marker lines of a trace in a single pass
+ * and matches each Exit marker line with the most recent unmatched
+ * Entry marker line of the same TID, object handle and API ID, such
+ * that nested calls with the same object handle and API ID match.
+ *
+ * With more than one thread, the trace is tokenized in chunks of lines
+ * and the markers are matched in partitions keyed by TID, both in
+ * parallel.
+ */
+class trace_parser
+{
+  public:
+  /**
+   * Return the API calls of the trace in order of Entry marker lines.
+   * The returned lines are views into 'trace'.
+   */
+  static std::vector<trace_call>
+  parse(std::string_view trace, unsigned int nthreads = 1);
+};
+
+} // namespace xrt_core::tools::xbreplay
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 #include "utils/message.hpp"
 
 namespace xrt_core::tools::xbreplay::utils {
@@ -15,6 +15,36 @@ void trim_spaces(std::string& entry)
   }).base(), entry.end());
 }
 
+/*
+ * This function is used to convert marker time "<sec>.<nsec>" to ns.
+ */
+uint64_t decode_time_ns(const std::string& time)
+{
+  constexpr uint64_t giga = 1000000000;
+  constexpr size_t nsec_digits = 9;
+
+  try
+  {
+    size_t pos = 0;
+    uint64_t ns = std::stoull(time, &pos) * giga;
+    if (pos < time.size() && time[pos] == '.')
+    {
+      auto nsec = time.substr(pos + 1, nsec_digits);
+      if (!nsec.empty())
+      {
+        nsec.append(nsec_digits - nsec.size(), '0');
+        ns += std::stoull(nsec);
+      }
+    }
+    return ns;
+  }
+  catch (const std::exception&)
+  {
+    XBREPLAY_WARN("Invalid marker time: ", time);
+    return 0;
+  }
+}
+
 /*
  * This function is used to retrive arguments from given string.
  */
@@ -59,7 +89,7 @@ replay_status message::update_args(const std::pair <std::string&, std::string&>
 void message::rmv_return_type(std::string& str)
 {
   /* Regular expression to match function signature (excluding return type)*/
-  std::regex pattern(regex_func_pattern);
+  static const std::regex pattern(regex_func_pattern);
 
   /* Check if the input string contains a function signature */
   std::smatch match;
@@ -96,7 +126,7 @@ replay_status message::decode_args(const std::string& line)
 
   if (line.find("...") != std::string::npos)
   {
-    std::regex pattern(regex_decode_args_pattern);
+    static const std::regex pattern(regex_decode_args_pattern);
     std::smatch matches;
     if (std::regex_search(line, matches, pattern))
     {
@@ -134,8 +164,8 @@ replay_status message::decode_args(const std::string& line)
       *        update the values.
       *
       */
-    std::regex regexFirst(regex_args_type_pattern);
-    std::regex regexSecond(regex_args_value_pattern);
+    static const std::regex regexFirst(regex_args_type_pattern);
+    static const std::regex regexSecond(regex_args_value_pattern);
 
     std::smatch match_firstline, match_secondline;
 
@@ -170,9 +200,12 @@ replay_status message::decode_entry_line(const std::string& line)
    * Entry trace marker is of below format and correspondigly update regex
    * ENTRY <number> <number> <number> <hex-value> ClassName::MethodName(arguments).
    **/
-  std::regex pattern(regex_entry_pattern);
+  static const std::regex pattern(regex_entry_pattern);
   if (std::regex_search(line, match, pattern))
   {
+    /* get recorded time */
+    m_entry_ns = decode_time_ns(match[match_idx_time]);
+
     /* get thread ID */
     m_tid = std::stoul(match[match_idx_tid], nullptr, base_hex);
 
@@ -314,7 +347,7 @@ void message::load_user_data(const uint32_t offset, std::vector<char>* user_data
  */
 replay_status message::decode_exit_line(const std::string& line)
 {
-  std::regex pattern(regex_exit_pattern);
+  static const std::regex pattern(regex_exit_pattern);
   std::smatch match;
   replay_status estatus = replay_status::success;
 
@@ -322,7 +355,10 @@ replay_status message::decode_exit_line(const std::string& line)
   {
     std::string mem_tag = match[match_idx_memtag].str();
 
-    std::regex return_val_pattern(regex_ret_val_pattern);
+    /* get recorded time */
+    m_exit_ns = decode_time_ns(match[match_idx_time]);
+
+    static const std::regex return_val_pattern(regex_ret_val_pattern);
     std::smatch ret_match;
     const std::string& api = match[match_idx_api].str();
     const std::string substr = ")=";
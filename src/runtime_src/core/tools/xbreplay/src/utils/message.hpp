@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -32,6 +32,7 @@ constexpr const char* regex_ret_val_pattern = (R"(=(\d+))");
 constexpr uint32_t mem_tag_value = 0x6d656du;
 constexpr uint32_t match_idx_arg_type = 1u;
 constexpr uint32_t match_idx_arg_value = 2u;
+constexpr uint32_t match_idx_time = 1u;
 constexpr uint32_t match_idx_tid = 3u;
 constexpr uint32_t match_idx_handle = 4u;
 constexpr uint32_t match_idx_memtag = 6u;
@@ -61,6 +62,10 @@ class message
   uint64_t  m_ret_val;
   uint64_t  m_handle;
   uint64_t  m_tid;
+  /* Recorded Entry and Exit marker time in ns since start of trace,
+   * exit time is 0 if Exit marker line is missing */
+  uint64_t  m_entry_ns = 0;
+  uint64_t  m_exit_ns = 0;
   std::vector<char>m_buf;
   bool m_is_mem_file_available;
   std::vector<std::pair<std::string, std::string>> m_args;
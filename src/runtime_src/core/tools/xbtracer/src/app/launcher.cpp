@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024 - 2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #include <array>
 #include <chrono>
@@ -12,6 +12,8 @@
 #include <string>
 #include <vector>
 
+#include "../lib/trace_bin.h"
+
 #ifdef _WIN32
 # include "getopt.h"
 # include <shlwapi.h>
@@ -68,6 +70,8 @@ class launcher
   // Public members
   bool m_debug = false;
   bool m_inst_debug = false;
+  bool m_bin_trace = false;
+  std::string m_convert;
   std::string m_name;
   std::string m_lib_path;
   std::string m_extra_lib;
@@ -284,10 +288,10 @@ int parse_cmdline(launcher& app, int argc, char* argv[])
   std::lock_guard lock(mutex);
 
 #ifdef _WIN32
-  while ((option = getopt(argc, argv, "vVL:")) != -1)
+  while ((option = getopt(argc, argv, "vVbc:L:")) != -1)
 #else
   // NOLINTNEXTLINE(concurrency-mt-unsafe) - getopt is protected by a mutex
-  while ((option = getopt(argc, argv, "vV")) != -1)
+  while ((option = getopt(argc, argv, "vVbc:")) != -1)
 #endif /* #ifdef _WIN32 */
   {
     switch (option)
@@ -300,6 +304,16 @@ int parse_cmdline(launcher& app, int argc, char* argv[])
         app.m_debug = true;
         app.m_inst_debug = true;
         break;
+
+      // Write binary trace records, converted to text at exit
+      case 'b':
+        app.m_bin_trace = true;
+        break;
+
+      // Convert binary trace records to text, no application is run
+      case 'c':
+        app.m_convert = optarg;
+        break;
 #ifdef _WIN32
       case 'L':
         if (std::filesystem::exists(optarg))
@@ -312,6 +326,9 @@ int parse_cmdline(launcher& app, int argc, char* argv[])
     }
   }
 
+  if (!app.m_convert.empty())
+    return 0;
+
   if (optind == argc)
     log_f("There should be alleast 1 argument without option switch");
 
@@ -353,6 +370,20 @@ int parse_cmdline(launcher& app, int argc, char* argv[])
   return 0;
 }
 
+/*
+ * Convert a binary trace to trace.txt in the same directory, for
+ * example to recover the text trace of an application that did not
+ * exit normally.
+ */
+int convert_trace(launcher& app)
+{
+  auto txt_path = std::filesystem::path(app.m_convert).parent_path()
+    / xrt::tools::xbtracer::xrt_trace_filename;
+  xrt::tools::xbtracer::convert_to_text(app.m_convert, txt_path.string());
+  std::cout << "\nText trace written to: " << txt_path.string() << "\n\n";
+  return 0;
+}
+
 // Time formatting and trace directory printing
 void print_trace_location(launcher& app)
 {
@@ -378,6 +409,14 @@ int set_envs(launcher& app)
   else
     log_f("Failed to set environment variable: TRACE_APP_NAME");
 
+  if (app.m_bin_trace)
+  {
+    if (set_env("TRACE_FORMAT", "bin"))
+      log_d("Environment variable set successfully: TRACE_FORMAT = bin");
+    else
+      log_f("Failed to set environment variable: TRACE_FORMAT");
+  }
+
   app.m_start_time = std::chrono::system_clock::now();
 
   std::ostringstream oss;
@@ -647,6 +686,9 @@ int win_launcher(int& argc, char* argv[])
   */
   parse_cmdline(app, argc, argv);
 
+  if (!app.m_convert.empty())
+    return convert_trace(app);
+
   /*
     Find and Check capture lib
   */
@@ -732,6 +774,9 @@ int posix_launcher(int& argc, char* argv[])
   */
   parse_cmdline(app, argc, argv);
 
+  if (!app.m_convert.empty())
+    return convert_trace(app);
+
   /* Find instrumentation library */
   app.m_lib_path = find_library_path(inst_lib_name);
 
@@ -1,11 +1,14 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #include "logger.h"
 #include "version.h"
 #include "detail/logger.h"
 
+#include <array>
+#include <atomic>
 #include <cinttypes>
+#include <condition_variable>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
@@ -25,6 +28,285 @@ constexpr unsigned int fw_9 = 9;
 //NOLINTNEXTLINE - env_mutex cann't be const
 std::mutex env_mutex;
 
+/*
+ * Single producer, single consumer ring of binary trace records.  The
+ * producer is the owning application thread, the consumer is the
+ * record_writer thread.  The head is advanced once per event such
+ * that the consumer never sees a partial event.
+ * */
+class record_ring
+{
+  static constexpr size_t capacity = 4096;  // records, power of 2
+  static constexpr size_t mask = capacity - 1;
+
+  std::array<trace_record, capacity> m_records{};
+  std::atomic<size_t> m_head{0};
+  std::atomic<size_t> m_tail{0};
+
+  public:
+  // Interned thread of owning thread
+  uint32_t m_tid = 0;
+
+  // Function names interned by this thread, accessed by producer only
+  std::unordered_map<const char*, uint32_t> m_names;
+
+  // Remaining room at which the writer is woken up
+  static constexpr size_t low_water = capacity / 4;
+
+  // Longer payload is truncated
+  static constexpr size_t max_event_records = 64;
+
+  size_t available() const
+  {
+    return capacity - (m_head.load(std::memory_order_relaxed)
+                       - m_tail.load(std::memory_order_acquire));
+  }
+
+  // Copy n records to the ring, caller has ensured room
+  void push(const trace_record* recs, size_t n)
+  {
+    auto head = m_head.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < n; ++i)
+      m_records[(head + i) & mask] = recs[i]; // NOLINT
+    m_head.store(head + n, std::memory_order_release);
+  }
+
+  // Write all published records to stream
+  void drain(std::ofstream& ofs)
+  {
+    auto tail = m_tail.load(std::memory_order_relaxed);
+    auto head = m_head.load(std::memory_order_acquire);
+    while (tail != head)
+    {
+      auto idx = tail & mask;
+      auto n = std::min(head - tail, capacity - idx);
+      // NOLINTNEXTLINE (cppcoreguidelines-pro-type-reinterpret-cast)
+      ofs.write(reinterpret_cast<const char*>(&m_records[idx]),
+                static_cast<std::streamsize>(n * sizeof(trace_record)));
+      tail += n;
+    }
+    m_tail.store(tail, std::memory_order_release);
+  }
+};
+
+/*
+ * Binary trace writer.  Application threads encode trace events into
+ * fixed size records in a per thread ring, which a background thread
+ * drains to the trace file.  No lock is taken on the logging path
+ * except when a thread logs for the first time.
+ * */
+class record_writer
+{
+  static constexpr auto drain_period = std::chrono::milliseconds(10);
+
+  std::ofstream m_ofs;
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<record_ring>> m_rings;
+  std::unordered_map<std::thread::id, uint32_t> m_tids;
+  std::atomic<uint32_t> m_next_name{0};
+
+  std::chrono::steady_clock::time_point m_steady_start;
+  uint64_t m_base_ns;
+
+  std::condition_variable m_cv;
+  bool m_stop = false;
+  std::thread m_thread;
+
+  static thread_local record_ring* t_ring;
+
+  uint64_t now_ns() const
+  {
+    return m_base_ns + std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - m_steady_start).count();
+  }
+
+  void drain_all()
+  {
+    std::vector<record_ring*> rings;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      for (auto& ring : m_rings)
+        rings.push_back(ring.get());
+    }
+
+    for (auto ring : rings)
+      ring->drain(m_ofs);
+  }
+
+  void writer_fn()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop)
+    {
+      m_cv.wait_for(lock, drain_period);
+      lock.unlock();
+      drain_all();
+      lock.lock();
+    }
+  }
+
+  // Encode an event with payload into records and push to the ring of
+  // calling thread, waiting for the writer to make room if necessary.
+  void push(record_ring* ring, trace_record rec, const char* payload, size_t len)
+  {
+    constexpr size_t inline_sz = sizeof(trace_record::payload);
+    constexpr size_t max_len = inline_sz + (record_ring::max_event_records - 1) * trace_record_size;
+    len = std::min(len, max_len);
+
+    std::array<trace_record, record_ring::max_event_records> recs;
+    rec.len = static_cast<uint32_t>(len);
+    std::memcpy(rec.payload, payload, std::min(len, inline_sz));
+    recs[0] = rec;
+    size_t n = 1 + trace_record_continuations(len);
+    // NOLINTNEXTLINE (cppcoreguidelines-pro-type-reinterpret-cast)
+    auto cont = reinterpret_cast<char*>(&recs[1]);
+    if (len > inline_sz)
+      std::memcpy(cont, payload + inline_sz, len - inline_sz); // NOLINT
+
+    while (ring->available() < n)
+    {
+      m_cv.notify_one();
+      std::this_thread::yield();
+    }
+    ring->push(recs.data(), n);
+
+    // Wake the writer early when the ring fills up
+    if (ring->available() < record_ring::low_water)
+      m_cv.notify_one();
+  }
+
+  void push_definition(record_ring* ring, record_kind kind, uint32_t id, const std::string& str)
+  {
+    trace_record rec{};
+    rec.kind = static_cast<uint32_t>(kind);
+    if (kind == record_kind::name)
+      rec.name = id;
+    else
+      rec.tid = id;
+    push(ring, rec, str.data(), str.size());
+  }
+
+  // Intern a thread, return its id and if it is new
+  std::pair<uint32_t, bool> intern_thread(std::thread::id tid)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto [itr, inserted] = m_tids.emplace(tid, static_cast<uint32_t>(m_tids.size()));
+    return {itr->second, inserted};
+  }
+
+  static std::string to_string(std::thread::id tid)
+  {
+    std::ostringstream oss;
+    oss << tid;
+    return oss.str();
+  }
+
+  record_ring* get_ring()
+  {
+    if (t_ring)
+      return t_ring;
+
+    auto ring = std::make_unique<record_ring>();
+    auto tid = std::this_thread::get_id();
+    auto [id, inserted] = intern_thread(tid);
+    ring->m_tid = id;
+    if (inserted)
+      push_definition(ring.get(), record_kind::thread, id, to_string(tid));
+
+    t_ring = ring.get();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_rings.push_back(std::move(ring));
+    return t_ring;
+  }
+
+  uint32_t intern_name(record_ring* ring, const char* func)
+  {
+    auto itr = ring->m_names.find(func);
+    if (itr != ring->m_names.end())
+      return itr->second;
+
+    auto id = m_next_name++;
+    push_definition(ring, record_kind::name, id, func);
+    ring->m_names.emplace(func, id);
+    return id;
+  }
+
+  public:
+  record_writer(const std::string& path, uint64_t pid, uint64_t base_ns)
+    : m_ofs(path, std::ios::out | std::ios::binary)
+    , m_steady_start(std::chrono::steady_clock::now())
+    , m_base_ns(base_ns)
+  {
+    trace_bin_header hdr{};
+    std::memcpy(hdr.magic, trace_bin_magic, sizeof(hdr.magic));
+    hdr.version = trace_bin_version;
+    hdr.record_size = trace_record_size;
+    hdr.pid = pid;
+    // NOLINTNEXTLINE (cppcoreguidelines-pro-type-reinterpret-cast)
+    m_ofs.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+
+    m_thread = std::thread(&record_writer::writer_fn, this);
+  }
+
+  ~record_writer()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cv.notify_one();
+    if (m_thread.joinable())
+      m_thread.join();
+
+    drain_all();
+  }
+
+  record_writer(const record_writer&) = delete;
+  record_writer(record_writer&&) = delete;
+  record_writer& operator=(const record_writer&) = delete;
+  record_writer& operator=(record_writer&&) = delete;
+
+  void log(trace_type type, const void* handle, const char* func,
+           const std::string& rest)
+  {
+    auto ring = get_ring();
+    log(ring, ring->m_tid, type, handle, func, rest);
+  }
+
+  void log(trace_type type, const void* handle, const char* func,
+           const std::string& rest, std::thread::id tid)
+  {
+    auto ring = get_ring();
+    auto [id, inserted] = intern_thread(tid);
+    if (inserted)
+      push_definition(ring, record_kind::thread, id, to_string(tid));
+    log(ring, id, type, handle, func, rest);
+  }
+
+  void log(record_ring* ring, uint32_t tid, trace_type type, const void* handle,
+           const char* func, const std::string& rest)
+  {
+    trace_record rec{};
+    rec.ts_ns = now_ns();
+    rec.handle = reinterpret_cast<uintptr_t>(handle); // NOLINT
+    rec.name = intern_name(ring, func);
+    rec.tid = tid;
+    rec.kind = static_cast<uint32_t>(type == trace_type::entry ? record_kind::entry : record_kind::exit);
+    push(ring, rec, rest.data(), rest.size());
+  }
+
+  // Verbatim line of the text trace
+  void text(const std::string& line)
+  {
+    trace_record rec{};
+    rec.ts_ns = now_ns();
+    rec.kind = static_cast<uint32_t>(record_kind::text);
+    push(get_ring(), rec, line.data(), line.size());
+  }
+};
+
+thread_local record_ring* record_writer::t_ring = nullptr;
+
 /*
  * Method to calculate the time-diffrence since start of the trace.
  * */
@@ -114,26 +396,34 @@ logger::logger()
 
   // Construct full path and open files for logging.
   std::ostringstream oss_full_path;
-  oss_full_path << "." <<path_separator << time_fmt_str << path_separator
-                << xrt_trace_filename;
-
-  m_fp.open(oss_full_path.str(), std::ios::out);
-
-  oss_full_path.str("");
-  oss_full_path.clear();
+  oss_full_path << "." << path_separator << time_fmt_str << path_separator;
+  m_trace_dir = oss_full_path.str();
 
-  oss_full_path << "." << path_separator << time_fmt_str << path_separator
-                << xrt_trace_bin_filename;
+  // Binary trace records are converted to the text trace at exit
+  //NOLINTNEXTLINE(concurrency-mt-unsafe) - protected by env_mutex
+  if (get_env("TRACE_FORMAT") == "bin")
+  {
+    auto base_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::system_clock::now() - m_start_time).count();
+    m_writer = std::make_unique<record_writer>(m_trace_dir + xrt_trace_rec_filename,
+                                               m_pid, base_ns);
+  }
+  else
+    m_fp.open(m_trace_dir + xrt_trace_filename, std::ios::out);
 
-  m_fp_bin.open(oss_full_path.str(), std::ios::out | std::ios::binary);
+  m_fp_bin.open(m_trace_dir + xrt_trace_bin_filename,
+                std::ios::out | std::ios::binary);
 
-  m_fp << "|HEADER|pname:\"" << m_program_name <<  "\"|m_pid:" << m_pid << "|xrt_ver:"
+  std::ostringstream oss;
+  oss << "|HEADER|pname:\"" << m_program_name <<  "\"|m_pid:" << m_pid << "|xrt_ver:"
      << XRT_DRIVER_VERSION << "|os:" << os_name_ver() << "|time:"
      << time_fmt_str << "." << std::setfill('0') << std::setw(fw_9)
      << ns.count() % giga << "|\n";
 
-  m_fp << "|START|"<< time_fmt_str << "." << std::setfill('0') << std::setw(fw_9)\
+  oss << "|START|"<< time_fmt_str << "." << std::setfill('0') << std::setw(fw_9)\
      << ns.count() % giga << "|\n";
+
+  write_text(oss.str());
 }
 
 /*
@@ -155,11 +445,42 @@ logger::~logger()
                     now.time_since_epoch());
   std::string time_fmt_str = tp_to_date_time_fmt(now);
 
-  m_fp << "|END|" << time_fmt_str << "." << std::setfill('0') << std::setw(fw_9)
+  std::ostringstream oss;
+  oss << "|END|" << time_fmt_str << "." << std::setfill('0') << std::setw(fw_9)
      << ns.count() % giga << "|\n";
+  write_text(oss.str());
 
   m_fp_bin.close();
   m_fp.close();
+
+  if (m_writer)
+  {
+    m_writer.reset();
+    try
+    {
+      convert_to_text(m_trace_dir + xrt_trace_rec_filename,
+                      m_trace_dir + xrt_trace_filename);
+    }
+    catch (const std::exception& ex)
+    {
+      std::cerr << "Failed to convert binary trace: " << ex.what() << std::endl;
+    }
+  }
+}
+
+/*
+ * Write a verbatim line to the trace.
+ * */
+void logger::write_text(const std::string& line)
+{
+  if (m_writer)
+  {
+    m_writer->text(line);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_fp_mutex);
+  m_fp << line;
 }
 
 void logger::synth_dtor_trace_fn()
@@ -189,30 +510,43 @@ void logger::synth_dtor_trace_fn()
 /*
  * API to capture Entry and Exit Trace.
  * */
-void logger::log(trace_type type, std::string str)
+void logger::log(trace_type type, const void* handle, const char* func,
+                 const std::string& rest)
 {
-  std::thread::id tid = std::this_thread::get_id();
+  if (m_writer)
+  {
+    m_writer->log(type, handle, func, rest);
+    return;
+  }
 
-  log(type, str, tid);
+  log(type, handle, func, rest, std::this_thread::get_id());
 }
 
 /*
  * API to capture Entry and Exit Trace with given thread-id.
  * */
-void logger::log(trace_type type, std::string str, std::thread::id tid)
+void logger::log(trace_type type, const void* handle, const char* func,
+                 const std::string& rest, std::thread::id tid)
 {
+  if (m_writer)
+  {
+    m_writer->log(type, handle, func, rest, tid);
+    return;
+  }
+
   auto time_now = std::chrono::system_clock::now();
 
   std::stringstream ss;
   ss << ((type == trace_type::entry) ? "|ENTRY|" : "|EXIT|")
      << timediff(time_now, m_start_time) << "|" << m_pid << "|" << tid << "|"
-     << str;
+     << handle << "|" << func << rest;
 
+  std::lock_guard<std::mutex> lock(m_fp_mutex);
   m_fp << ss.str();
 
   if (m_inst_debug)
     m_fp << std::flush;
-};
+}
 
 // Function to read OS name and version
 std::string logger::os_name_ver()
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -8,6 +8,7 @@
 #include <ctime>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <thread>
 #include <tuple>
@@ -15,6 +16,8 @@
 #include <vector>
 #include <filesystem>
 
+#include "trace_bin.h"
+
 #include "xrt/xrt_hw_context.h"
 #include "xrt/experimental/xrt_xclbin.h"
 #include "xrt/experimental/xrt_module.h"
@@ -30,7 +33,6 @@
 
 namespace xrt::tools::xbtracer {
 
-constexpr const char* xrt_trace_filename = "trace.txt";
 constexpr const char* xrt_trace_bin_filename = "memdump.bin";
 
 extern std::unordered_map<void*, std::string> fptr2fname_map;
@@ -86,11 +88,16 @@ class membuf
 template <typename... Args>
 std::string stringify_args(const Args&... args);
 
+class record_writer;
+
 class logger
 {
   private:
   std::ofstream m_fp;
   std::ofstream m_fp_bin;
+  std::mutex m_fp_mutex;
+  std::unique_ptr<record_writer> m_writer;
+  std::string m_trace_dir;
   std::string m_program_name;
   bool m_inst_debug;
   bool m_is_destructing = false;
@@ -102,29 +109,29 @@ class logger
   std::chrono::time_point<std::chrono::system_clock> m_start_time{};
   std::thread synth_dtor_trace_thread;
   std::vector<std::tuple<std::shared_ptr<xrt_core::device>, std::thread::id,
-                         std::string>> m_dev_ref_tracker;
+                         const char*>> m_dev_ref_tracker;
   std::vector<std::tuple<std::shared_ptr<kernel_impl>, std::thread::id,
-                         std::string>> m_krnl_ref_tracker;
+                         const char*>> m_krnl_ref_tracker;
   std::vector<std::tuple<std::shared_ptr<run_impl>, std::thread::id,
-                         std::string>> m_run_ref_tracker;
+                         const char*>> m_run_ref_tracker;
   std::vector<std::tuple<std::shared_ptr<bo_impl>, std::thread::id,
-                         std::string>> m_bo_ref_tracker;
+                         const char*>> m_bo_ref_tracker;
   std::vector<std::tuple<std::shared_ptr<hw_context_impl>, std::thread::id,
-                         std::string>> m_hw_cnxt_ref_tracker;
+                         const char*>> m_hw_cnxt_ref_tracker;
   std::vector<std::tuple<std::shared_ptr<module_impl>, std::thread::id,
-                         std::string>> m_mod_ref_tracker;
+                         const char*>> m_mod_ref_tracker;
   std::vector<std::tuple<std::shared_ptr<elf_impl>, std::thread::id,
-                         std::string>> m_elf_ref_tracker;
+                         const char*>> m_elf_ref_tracker;
 
   template <typename T>
   bool check_ref_count(std::vector<std::tuple<std::shared_ptr<T>,
-                       std::thread::id, std::string>>& tuples)
+                       std::thread::id, const char*>>& tuples)
   {
     bool bfound = false;
 
     for( auto it = tuples.begin(); it != tuples.end(); )
     {
-      std::string dtor_name;
+      const char* dtor_name = nullptr;
       std::shared_ptr<T> pimpl;
       std::thread::id tid;
       std::tie(pimpl, tid, dtor_name) = *it;
@@ -137,10 +144,10 @@ class logger
       }
       else
       {
-        logger::get_instance().log(trace_type::entry, stringify_args(pimpl)
-                                   + "|" + dtor_name + "()|\n", tid);
-        logger::get_instance().log(trace_type::exit, stringify_args(pimpl)
-                                   + "|" + dtor_name + "||\n", tid);
+        logger::get_instance().log(trace_type::entry, pimpl.get(), dtor_name,
+                                   "()|\n", tid);
+        logger::get_instance().log(trace_type::exit, pimpl.get(), dtor_name,
+                                   "||\n", tid);
         tuples.erase(it);
       }
     }
@@ -150,6 +157,8 @@ class logger
 
   void synth_dtor_trace_fn();
 
+  void write_text(const std::string& line);
+
   /*
    * constructor
    * */
@@ -238,9 +247,15 @@ class logger
 
   /*
    * API to capture Entry and Exit Trace.
+   *
+   * The trace line is "<handle>|<func><rest>".  The function name must
+   * be a string with static storage duration, it is interned by address
+   * in binary trace mode.
    * */
-  void log(trace_type type, std::string str);
-  void log(trace_type type, std::string str, std::thread::id tid);
+  void log(trace_type type, const void* handle, const char* func,
+           const std::string& rest);
+  void log(trace_type type, const void* handle, const char* func,
+           const std::string& rest, std::thread::id tid);
 };
 
 template <typename... Args>
@@ -378,8 +393,7 @@ namespace xtx = xrt::tools::xbtracer;
       break;                                                                   \
     }                                                                          \
     auto __handle = this->get_handle();                                        \
-    xtx::logger::get_instance().log(xtx::trace_type::entry,                    \
-        xtx::stringify_args(__handle.get(), "|", f) +                          \
+    xtx::logger::get_instance().log(xtx::trace_type::entry, __handle.get(), f, \
         "(" + xtx::concat_args(__VA_ARGS__) + ")|\n");                         \
   }                                                                            \
   while (0)                                                                    \
@@ -397,8 +411,7 @@ namespace xtx = xrt::tools::xbtracer;
       break;                                                                   \
     }                                                                          \
     auto __handle = this->get_handle();                                        \
-    xtx::logger::get_instance().log(xtx::trace_type::exit,                     \
-        xtx::stringify_args(__handle.get(), "|", f) +                          \
+    xtx::logger::get_instance().log(xtx::trace_type::exit, __handle.get(), f,  \
         "|" + xtx::concat_args_nv(__VA_ARGS__) + "|\n");                       \
   }                                                                            \
   while (0)
@@ -416,8 +429,7 @@ namespace xtx = xrt::tools::xbtracer;
       break;                                                                   \
     }                                                                          \
     auto __handle = this->get_handle();                                        \
-    xtx::logger::get_instance().log(xtx::trace_type::exit,                     \
-        xtx::stringify_args(__handle.get(), "|", f) +                          \
+    xtx::logger::get_instance().log(xtx::trace_type::exit, __handle.get(), f,  \
         "=" + xtx::stringify_args(r) + "|" + xtx::concat_args_nv(__VA_ARGS__)  \
         + "|\n");                                                              \
   }                                                                            \
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+#include "trace_bin.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace xrt::tools::xbtracer {
+
+constexpr uint64_t giga = 1000000000ULL;
+constexpr unsigned int fw_9 = 9;
+
+namespace {
+
+struct event
+{
+  uint64_t ts_ns;
+  uint64_t handle;
+  uint32_t name;
+  uint32_t tid;
+  record_kind kind;
+  std::string payload;
+};
+
+/*
+ * Read all records of a binary trace, collecting name and thread
+ * definitions and events.
+ * */
+void read_records(std::ifstream& ifs, std::unordered_map<uint32_t, std::string>& names,
+                  std::unordered_map<uint32_t, std::string>& threads,
+                  std::vector<event>& events)
+{
+  trace_record rec{};
+  // NOLINTNEXTLINE (cppcoreguidelines-pro-type-reinterpret-cast)
+  while (ifs.read(reinterpret_cast<char*>(&rec), sizeof(rec)))
+  {
+    std::string payload(rec.payload, std::min<size_t>(rec.len, sizeof(rec.payload)));
+    for (size_t i = trace_record_continuations(rec.len); i > 0; --i)
+    {
+      std::array<char, trace_record_size> cont{};
+      if (!ifs.read(cont.data(), cont.size()))
+        throw std::runtime_error("Truncated record in binary trace\n");
+      payload.append(cont.data(), std::min<size_t>(rec.len - payload.size(), cont.size()));
+    }
+
+    switch (static_cast<record_kind>(rec.kind))
+    {
+      case record_kind::name:
+        names[rec.name] = std::move(payload);
+        break;
+      case record_kind::thread:
+        threads[rec.tid] = std::move(payload);
+        break;
+      case record_kind::entry:
+      case record_kind::exit:
+      case record_kind::text:
+        events.push_back({rec.ts_ns, rec.handle, rec.name, rec.tid,
+                          static_cast<record_kind>(rec.kind), std::move(payload)});
+        break;
+      default:
+        throw std::runtime_error("Unknown record kind in binary trace\n");
+    }
+  }
+}
+
+} // namespace
+
+void convert_to_text(const std::string& bin_path, const std::string& txt_path)
+{
+  std::ifstream ifs(bin_path, std::ios::binary);
+  if (!ifs)
+    throw std::runtime_error("Failed to open " + bin_path + "\n");
+
+  trace_bin_header hdr{};
+  // NOLINTNEXTLINE (cppcoreguidelines-pro-type-reinterpret-cast)
+  if (!ifs.read(reinterpret_cast<char*>(&hdr), sizeof(hdr))
+      || std::memcmp(hdr.magic, trace_bin_magic, sizeof(hdr.magic)) != 0)
+    throw std::runtime_error(bin_path + " is not a binary trace\n");
+
+  if (hdr.version != trace_bin_version || hdr.record_size != trace_record_size)
+    throw std::runtime_error("Unsupported binary trace version in " + bin_path + "\n");
+
+  std::unordered_map<uint32_t, std::string> names;
+  std::unordered_map<uint32_t, std::string> threads;
+  std::vector<event> events;
+  read_records(ifs, names, threads, events);
+
+  // Records of one thread are in order, restore global order
+  std::stable_sort(events.begin(), events.end(),
+                   [](const event& a, const event& b) { return a.ts_ns < b.ts_ns; });
+
+  std::ofstream ofs(txt_path);
+  if (!ofs)
+    throw std::runtime_error("Failed to open " + txt_path + "\n");
+
+  for (const auto& ev : events)
+  {
+    if (ev.kind == record_kind::text)
+    {
+      ofs << ev.payload;
+      continue;
+    }
+
+    // NOLINTNEXTLINE (performance-no-int-to-ptr)
+    auto handle = reinterpret_cast<const void*>(static_cast<uintptr_t>(ev.handle));
+    ofs << ((ev.kind == record_kind::entry) ? "|ENTRY|" : "|EXIT|")
+        << (ev.ts_ns / giga) << "." << std::setfill('0') << std::setw(fw_9)
+        << (ev.ts_ns % giga) << "|" << hdr.pid << "|" << threads[ev.tid] << "|"
+        << handle << "|" << names[ev.name] << ev.payload;
+  }
+
+  if (!ofs)
+    throw std::runtime_error("Failed to write " + txt_path + "\n");
+}
+
+} // namespace xrt::tools::xbtracer
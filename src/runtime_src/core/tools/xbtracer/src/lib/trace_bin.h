@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace xrt::tools::xbtracer {
+
+/*
+ * Binary trace format
+ *
+ * The binary trace is a file header followed by a stream of fixed size
+ * records.  An event record carries the timestamp, the handle, the
+ * interned function name and the interned thread of an ENTRY or EXIT
+ * trace, plus the remainder of the trace line as payload.  Payload that
+ * does not fit in the event record continues in raw payload records
+ * that immediately follow the event record.
+ *
+ * Function names and threads are defined once by name and thread
+ * records, which use the same payload scheme.  Text records carry a
+ * verbatim line of the text trace (HEADER, START, END).
+ *
+ * Records from different threads are interleaved in the file in the
+ * order they were drained, not in timestamp order.  Conversion to text
+ * restores timestamp order.
+ * */
+constexpr const char* xrt_trace_filename = "trace.txt";
+constexpr const char* xrt_trace_rec_filename = "trace.bin";
+constexpr char trace_bin_magic[8] = {'X','B','T','R','A','C','E','\0'};
+constexpr uint32_t trace_bin_version = 1;
+
+enum class record_kind : uint32_t {
+  entry,
+  exit,
+  name,
+  thread,
+  text
+};
+
+struct trace_bin_header
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t record_size;
+  uint64_t pid;
+};
+
+constexpr size_t trace_record_size = 64;
+
+struct trace_record
+{
+  uint64_t ts_ns;     // ns since start of trace
+  uint64_t handle;    // object handle of the traced call
+  uint32_t name;      // interned function name (name id for name records)
+  uint32_t tid;       // interned thread (thread id for thread records)
+  uint32_t kind;      // record_kind
+  uint32_t len;       // total payload length including continuation
+  char payload[trace_record_size - 32];
+};
+
+static_assert(sizeof(trace_record) == trace_record_size, "bad trace record size");
+
+/*
+ * Number of continuation records following a record with payload of
+ * specified length.
+ * */
+constexpr size_t trace_record_continuations(size_t len)
+{
+  constexpr size_t inline_sz = sizeof(trace_record::payload);
+  return len <= inline_sz ? 0 : (len - inline_sz + trace_record_size - 1) / trace_record_size;
+}
+
+/*
+ * Convert a binary trace to the text trace format consumed by xbreplay.
+ * Throws on error.
+ * */
+void convert_to_text(const std::string& bin_path, const std::string& txt_path);
+
+} // namespace xrt::tools::xbtracer
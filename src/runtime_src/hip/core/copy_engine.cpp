@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+#include "copy_engine.h"
+
+#include <algorithm>
+#include <exception>
+#include <map>
+
+namespace {
+
+// Copies smaller than two chunks are executed by one worker
+constexpr size_t default_chunk_size = 4 * 1024 * 1024;
+
+constexpr unsigned int max_workers = 8;
+
+unsigned int
+default_workers()
+{
+  auto hw = std::thread::hardware_concurrency();
+  return std::clamp<unsigned int>(hw / 2, 2, max_workers);
+}
+
+} // namespace
+
+namespace xrt::core::hip {
+
+copy_engine::
+copy_engine(unsigned int workers, size_t chunk_size)
+  : m_chunk_size(chunk_size)
+{
+  for (unsigned int i = 0; i < workers; ++i)
+    m_workers.emplace_back([this] { worker(); });
+}
+
+copy_engine::
+~copy_engine()
+{
+  m_queue.stop();
+  for (auto& t : m_workers)
+    t.join();
+}
+
+void
+copy_engine::
+worker()
+{
+  while (true) {
+    auto ch = m_queue.getWork();
+    if (!ch.job)
+      break;
+
+    auto& job = ch.job;
+    hipError_t err = hipSuccess;
+    try {
+      err = job->m_copy(ch.offset, ch.size);
+    }
+    catch (const std::exception&) {
+      err = hipErrorUnknown;
+    }
+
+    if (err != hipSuccess) {
+      hipError_t expected = hipSuccess;
+      job->m_error.compare_exchange_strong(expected, err);
+    }
+
+    if (job->m_chunks_remaining.fetch_sub(1) == 1)
+      complete(job);
+  }
+}
+
+void
+copy_engine::
+dispatch(const std::shared_ptr<copy_job>& job)
+{
+  auto size = job->m_size;
+  auto nchunks = (size >= 2 * m_chunk_size) ? (size + m_chunk_size - 1) / m_chunk_size : 1;
+  nchunks = std::min<size_t>(nchunks, m_workers.size());
+  auto chunk_size = (size + nchunks - 1) / nchunks;
+
+  job->m_chunks_remaining = nchunks;
+  for (size_t idx = 0; idx < nchunks; ++idx) {
+    auto offset = idx * chunk_size;
+    m_queue.addWork({job, offset, std::min(chunk_size, size - offset)});
+  }
+}
+
+void
+copy_engine::
+complete(const std::shared_ptr<copy_job>& job)
+{
+  auto err = job->m_error.load();
+  if (job->m_callback)
+    job->m_callback(err);
+
+  {
+    std::lock_guard lk(job->m_mutex);
+    job->m_done = true;
+  }
+  job->m_done_cv.notify_all();
+
+  // Release the next job of the strand, if any
+  auto& strand = job->m_strand;
+  std::shared_ptr<copy_job> next;
+  {
+    std::lock_guard lk(strand->m_mutex);
+    if (strand->m_pending.empty()) {
+      strand->m_active = false;
+      return;
+    }
+    next = std::move(strand->m_pending.front());
+    strand->m_pending.pop_front();
+  }
+  dispatch(next);
+}
+
+std::shared_ptr<copy_engine::copy_job>
+copy_engine::
+submit(const std::shared_ptr<copy_strand>& strand, copy_function fcn, size_t size, completion_callback cb)
+{
+  auto job = std::make_shared<copy_job>(std::move(fcn), size, std::move(cb), strand);
+  {
+    std::lock_guard lk(strand->m_mutex);
+    if (strand->m_active) {
+      strand->m_pending.push_back(job);
+      return job;
+    }
+    strand->m_active = true;
+  }
+  dispatch(job);
+  return job;
+}
+
+copy_engine&
+copy_engine::
+get(uint32_t device_id)
+{
+  static std::mutex mutex;
+  static std::map<uint32_t, std::unique_ptr<copy_engine>> engines;
+  std::lock_guard lk(mutex);
+  auto& engine = engines[device_id];
+  if (!engine)
+    engine = std::make_unique<copy_engine>(default_workers(), default_chunk_size);
+  return *engine;
+}
+
+} // xrt::core::hip
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef xrthip_copy_engine_h
+#define xrthip_copy_engine_h
+
+#include "hip/config.h"
+#include "hip/hip_runtime_api.h"
+
+#include "core/common/task.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace xrt::core::hip {
+
+// class copy_engine - per device pool of persistent copy workers
+//
+// Asynchronous copies (hipMemcpyAsync, hipMemsetAsync, ...) are
+// executed by a fixed set of worker threads per device rather than
+// by a new thread per copy.
+//
+// A copy is described by a copy_job whose function copies an
+// arbitrary [offset, offset + size) range of the full copy.  Large
+// copies are split into chunks that are executed concurrently by
+// multiple workers; the job completes when all chunks have completed.
+//
+// Jobs submitted to the same copy_strand (one per stream) execute in
+// submission order, a job is not dispatched to the workers until the
+// previous job of the strand has completed.  Jobs from different
+// strands execute concurrently.
+class copy_engine
+{
+public:
+  // Copy function for a range of the full copy
+  using copy_function = std::function<hipError_t(size_t offset, size_t size)>;
+
+  // Completion callback, called by the worker thread that completes the
+  // last chunk of a job
+  using completion_callback = std::function<void(hipError_t)>;
+
+  class copy_strand;
+
+  class copy_job
+  {
+    friend class copy_engine;
+
+    copy_function m_copy;
+    completion_callback m_callback;
+    size_t m_size;
+    std::shared_ptr<copy_strand> m_strand;
+
+    std::atomic<size_t> m_chunks_remaining {0};
+    std::atomic<hipError_t> m_error {hipSuccess};
+
+    std::mutex m_mutex;
+    std::condition_variable m_done_cv;
+    bool m_done = false;
+
+  public:
+    copy_job(copy_function fcn, size_t size, completion_callback cb, std::shared_ptr<copy_strand> strand)
+      : m_copy(std::move(fcn)), m_callback(std::move(cb)), m_size(size), m_strand(std::move(strand))
+    {}
+
+    // Block until all chunks of the job have completed
+    hipError_t
+    wait()
+    {
+      std::unique_lock lk(m_mutex);
+      m_done_cv.wait(lk, [this] { return m_done; });
+      return m_error;
+    }
+
+    bool
+    done()
+    {
+      std::lock_guard lk(m_mutex);
+      return m_done;
+    }
+  };
+
+  // Ordering domain for jobs, typically one per stream
+  class copy_strand
+  {
+    friend class copy_engine;
+    std::mutex m_mutex;
+    std::deque<std::shared_ptr<copy_job>> m_pending;
+    bool m_active = false;
+  };
+
+private:
+  // Unit of work for a worker thread.  A default constructed chunk
+  // (no job) is returned by the queue when the engine is stopped
+  struct chunk
+  {
+    std::shared_ptr<copy_job> job;
+    size_t offset = 0;
+    size_t size = 0;
+  };
+
+  xrt_core::task::mpmcqueue<chunk> m_queue;
+  std::vector<std::thread> m_workers;
+  size_t m_chunk_size;
+
+  void
+  worker();
+
+  void
+  dispatch(const std::shared_ptr<copy_job>& job);
+
+  void
+  complete(const std::shared_ptr<copy_job>& job);
+
+public:
+  copy_engine(unsigned int workers, size_t chunk_size);
+  ~copy_engine();
+
+  copy_engine(const copy_engine&) = delete;
+  copy_engine(copy_engine&&) = delete;
+  copy_engine& operator=(const copy_engine&) = delete;
+  copy_engine& operator=(copy_engine&&) = delete;
+
+  // Submit a copy of 'size' bytes.  The job is ordered after all
+  // previously submitted jobs of 'strand'.
+  std::shared_ptr<copy_job>
+  submit(const std::shared_ptr<copy_strand>& strand, copy_function fcn, size_t size, completion_callback cb = nullptr);
+
+  // Get the copy engine for a device, created on first use
+  static copy_engine&
+  get(uint32_t device_id);
+};
+
+} // xrt::core::hip
+
+#endif
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #include "event.h"
 #include "memory.h"
@@ -204,16 +204,39 @@ bool kernel_start::wait()
   return false;
 }
 
-bool memcpy_command::submit()
+void copy_engine_command::submit_copy(copy_engine::copy_function fcn, size_t size)
 {
-  m_handle = std::async(std::launch::async, &hipMemcpy, m_dst, m_src, m_size, m_kind);
-  return true;
+  if (m_job)
+    return; // already submitted
+
+  set_state(state::running);
+  auto& engine = copy_engine::get(cstream->get_device()->get_device_id());
+  m_job = engine.submit(cstream->get_copy_strand(), std::move(fcn), size,
+                        [this] (hipError_t err) { set_state(err == hipSuccess ? state::completed : state::error); });
 }
 
-bool memcpy_command::wait()
+copy_engine_command::~copy_engine_command()
 {
-  m_handle.wait();
-  set_state(state::completed);
+  if (m_job)
+    m_job->wait();
+}
+
+bool copy_engine_command::wait()
+{
+  if (!m_job)
+    return false;
+
+  auto err = m_job->wait();
+  return err == hipSuccess;
+}
+
+bool memcpy_command::submit()
+{
+  submit_copy([dst = m_dst, src = m_src, kind = m_kind] (size_t offset, size_t size) {
+    return hipMemcpy(static_cast<unsigned char*>(dst) + offset,
+                     static_cast<const unsigned char*>(src) + offset,
+                     size, kind);
+  }, m_size);
   return true;
 }
 
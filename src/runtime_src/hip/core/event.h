@@ -1,9 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 #ifndef xrthip_event_h
 #define xrthip_event_h
 
 #include "common.h"
+#include "copy_engine.h"
 #include "memory.h"
 #include "memory_pool.h"
 #include "module.h"
@@ -12,6 +13,7 @@
 #include "xrt/xrt_bo.h"
 #include "core/common/api/kernel_int.h"
 
+#include <atomic>
 #include <condition_variable>
 #include <future>
 #include <memory>
@@ -49,7 +51,9 @@ protected:
   type ctype = type::event;
   std::shared_ptr<stream> cstream;
   std::chrono::time_point<std::chrono::system_clock> ctime;
-  state cstate = state::init;
+
+  // State is updated by copy engine workers upon completion
+  std::atomic<state> cstate {state::init};
 
 public:
   command() = default;
@@ -131,55 +135,74 @@ public:
   bool wait() override;
 };
 
+// Base class for commands executed by the device copy engine.
+// The copy is ordered with other copies in the same stream.  The
+// command state is set to completed (or error) by the copy engine
+// worker that completes the copy.
+class copy_engine_command : public command
+{
+  std::shared_ptr<copy_engine::copy_job> m_job;
+
+protected:
+  explicit copy_engine_command(std::shared_ptr<stream> s)
+    : command(command::type::mem_cpy, std::move(s))
+  {}
+
+  // Submit the copy to the device copy engine.  The copy function
+  // must not reference the derived command object, it is called
+  // from worker threads that may outlive the derived object.
+  void
+  submit_copy(copy_engine::copy_function fcn, size_t size);
+
+public:
+  // The completion callback of the copy job references this command
+  ~copy_engine_command() override;
+
+  bool wait() override;
+};
+
 // memcpy command for hipMemcpyAsync
-class memcpy_command : public command
+class memcpy_command : public copy_engine_command
 {
 public:
   memcpy_command(std::shared_ptr<stream> s, void* dst, const void* src, size_t size, hipMemcpyKind kind)
-    : command(command::type::mem_cpy, std::move(s)), m_dst(dst), m_src(src), m_size(size), m_kind(kind)
+    : copy_engine_command(std::move(s)), m_dst(dst), m_src(src), m_size(size), m_kind(kind)
   {}
   bool submit() override;
-  bool wait() override;
 
 protected:
   void* m_dst; 
   const void* m_src; 
   size_t m_size;
   hipMemcpyKind m_kind;
-  std::future<hipError_t> m_handle;
 };
 
 // copy command for copying data from a source only host buffer of type std::vector<uint8|uint16|uint32>
 template<class T>
-class copy_from_host_buffer_command : public command
+class copy_from_host_buffer_command : public copy_engine_command
 {
 public:
   copy_from_host_buffer_command(std::shared_ptr<stream> s, std::shared_ptr<memory> buf, std::vector<T>&& vec, size_t size, size_t offset)
-    : command(command::type::mem_cpy, std::move(s)), buffer(std::move(buf)), host_vec(std::move(vec)), copy_size(size), dev_offset(offset)
+    : copy_engine_command(std::move(s)), buffer(std::move(buf)), host_vec(std::make_shared<std::vector<T>>(std::move(vec))), copy_size(size), dev_offset(offset)
   {
   }
 
   bool
   submit() override
   {
-    handle = std::async(std::launch::async, &memory::write, buffer, host_vec.data(), copy_size, 0, dev_offset);
-    return true;
-  }
-
-  bool
-  wait() override
-  {
-    handle.wait();
-    set_state(state::completed);
+    submit_copy([buf = buffer, vec = host_vec, off = dev_offset] (size_t offset, size_t size) {
+      auto src = reinterpret_cast<const unsigned char*>(vec->data());
+      buf->write(src, size, offset, off + offset);
+      return hipSuccess;
+    }, copy_size);
     return true;
   }
 
 private:
   std::shared_ptr<memory> buffer; // device buffer
-  std::vector<T> host_vec; // host buffer (source only, not valid as destination)
+  std::shared_ptr<std::vector<T>> host_vec; // host buffer (source only, not valid as destination)
   size_t copy_size;
   size_t dev_offset; // offset for device memory
-  std::future<void> handle;
 };
 
 class memory_pool_command : public command
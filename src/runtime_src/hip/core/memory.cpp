@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -105,7 +105,10 @@ namespace xrt::core::hip
     auto src_ptr = reinterpret_cast<const unsigned char*>(src);
     src_ptr += src_offset;
     m_bo.write(src_ptr, size, offset);
-    m_bo.sync(XCL_BO_SYNC_BO_TO_DEVICE);
+
+    // Sync only the written range, copies may be split into chunks
+    // that are written concurrently by copy engine workers
+    m_bo.sync(XCL_BO_SYNC_BO_TO_DEVICE, size, offset);
   }
 
   void
@@ -121,7 +124,7 @@ namespace xrt::core::hip
     auto dst_ptr = reinterpret_cast<unsigned char *>(dst);
     dst_ptr += dst_offset;
     if (m_bo) {
-      m_bo.sync(XCL_BO_SYNC_BO_FROM_DEVICE);
+      m_bo.sync(XCL_BO_SYNC_BO_FROM_DEVICE, size, offset);
       m_bo.read(dst_ptr, size, offset);
     }
   }
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #include "core/common/unistd.h"
 #include "hip/config.h"
@@ -8,6 +8,9 @@
 #include "common.h"
 #include "memory_pool.h"
 
+#include <functional>
+#include <thread>
+
 namespace xrt::core::hip
 {
   // Global map of memory_pool associated with device id.
@@ -17,88 +20,14 @@ namespace xrt::core::hip
   // Global map of memory_pool associated with its handle.
   xrt_core::handle_map<mem_pool_handle, std::shared_ptr<memory_pool>> mem_pool_cache;
 
-  static void
-  dlinkedlist_delete(std::shared_ptr<memory_pool_slot>& head, std::shared_ptr<memory_pool_slot>& node)
-  {
-    if (node->m_prev == nullptr) {
-      head = node->m_next;
-      if (node->m_next != nullptr)
-        node->m_next->m_prev = nullptr;
-    } 
-    else {
-      node->m_prev->m_next = node->m_next;
-      if (node->m_next!= nullptr)
-        node->m_next->m_prev = node->m_prev;
-    }
-  }
-
-  static void
-  dlinkedlist_insert(std::shared_ptr<memory_pool_slot>& head, std::shared_ptr<memory_pool_slot>& node)
-  {    
-    node->m_prev = nullptr;
-    node->m_next = head;
-    if (head != nullptr)
-      head->m_prev = node;
-    head = node;
-  }
-
-  memory_pool_slot::memory_pool_slot(size_t start, size_t size)
-      : m_start(start), m_size(size), m_prev(nullptr), m_next(nullptr), m_is_free(true)
-  {
-  }
-
   memory_pool_node::memory_pool_node(device* device, size_t size, int id)
-      : m_id(id), m_used(0), m_free_list(nullptr), m_alloc_list(nullptr)
-  {
-    m_memory = std::make_shared<memory>(device, size);
-    m_free_list = std::make_shared<memory_pool_slot>(0, size);
-  }
-
-  // merge adjacent free slots as one slot
-  void
-  memory_pool_node::merge_free_slots(std::shared_ptr<memory_pool_slot> new_free_slot)
-  {
-    std::shared_ptr<memory_pool_slot> p0 = new_free_slot;
-    std::shared_ptr<memory_pool_slot> p1 = new_free_slot;
-
-    while (p0 && p0->is_free()) {
-      p1 = p0;
-      if (p0->start() == 0)
-        break;
-      p0 = p0->prev();
-    }
-
-    p0 = p1->next();
-    while (p0 && p0->start() < m_memory->get_size() && p0->is_free()) {
-      dlinkedlist_delete(m_free_list, p0);
-      p1->set_size(p1->get_size() + p0->get_size());
-      p0 = p0->next();
-    }
-  }
-
-  size_t
-  memory_pool_node::free(size_t start)
+      : m_id(id), m_memory(std::make_shared<memory>(device, size)), m_allocator(size, xrt_core::getpagesize())
   {
-    size_t size_freed = 0;
-    auto used_slot = m_alloc_list;
-    while (used_slot) {
-      if (used_slot->m_start == start ) {
-        size_freed = used_slot->get_size();
-        m_used -= size_freed;
-        dlinkedlist_delete(m_alloc_list, used_slot);
-        dlinkedlist_insert(m_free_list, used_slot);
-        used_slot->m_is_free = true;
-        merge_free_slots(used_slot);
-        break;
-      }
-      used_slot = used_slot->m_next;
-    }
-    return size_freed;
   }
 
   memory_pool::memory_pool(device* device, size_t max_total_size, size_t pool_size)
       : m_device(device), m_last_id(0), m_auto_extend(true), m_max_total_size(max_total_size), m_pool_size(pool_size), m_list(), m_mutex(),
-        m_reuse_follow_event_dependencies(1), m_reuse_allow_opportunistic(1), m_reuse_allow_internal_dependencies(1),
+        m_page_size(xrt_core::getpagesize()), m_reuse_follow_event_dependencies(1), m_reuse_allow_opportunistic(1), m_reuse_allow_internal_dependencies(1),
         m_release_threshold(0), m_reserved_mem_current(0), m_reserved_mem_high(0), m_used_mem_current(0), m_used_mem_high(0)
   {
     init();
@@ -230,7 +159,43 @@ namespace xrt::core::hip
     return true;
   }
 
-  // create allocation from a free slot in the memory pool
+  memory_pool::cache_shard&
+  memory_pool::get_cache_shard()
+  {
+    thread_local const size_t shard = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return m_cache[shard % cache_shards];
+  }
+
+  size_t
+  memory_pool::get_size_class(size_t aligned_size) const
+  {
+    auto pages = aligned_size / m_page_size;
+    return (pages && pages <= cache_size_classes) ? pages - 1 : cache_size_classes;
+  }
+
+  void
+  memory_pool::flush_cache()
+  {
+    for (auto& shard : m_cache) {
+      std::lock_guard lock(shard.m_mutex);
+      for (auto& bin : shard.m_bins) {
+        for (auto& blk : bin)
+          blk.node->free(blk.offset);
+        bin.clear();
+      }
+    }
+  }
+
+  void
+  memory_pool::add_used_mem(size_t size)
+  {
+    auto used = m_used_mem_current.fetch_add(size) + size;
+    auto high = m_used_mem_high.load();
+    while (high < used && !m_used_mem_high.compare_exchange_weak(high, used))
+      ;
+  }
+
+  // create allocation from a free block in the memory pool
   void
   memory_pool::malloc(void* ptr, size_t size)
   {
@@ -247,97 +212,61 @@ namespace xrt::core::hip
     // every allocation from pool has page size alignment
     size_t aligned_size = get_page_aligned_size(size);
 
-    std::lock_guard lock(m_mutex);
-
     if (aligned_size > m_pool_size)
       throw std::runtime_error("requested size is greater than memory pool block size.");
 
-    std::shared_ptr<memory_pool_node> mm;
-
-    uint32_t num_tries = 0;
-    // find first free slot that fits, if none is found, enlarge the pool and try one more time
-    while (num_tries <= 2) {
-      ++ num_tries;
-      auto mp_itr = m_list.begin();
-      while (mp_itr != m_list.end()){
-        mm = *mp_itr;
-        // skip blocks with too liitle memory left to fit the required aligned_size
-        if (m_pool_size - mm->m_used < aligned_size) {
-          mp_itr++;
+    // small blocks are first looked up in the cache of the calling thread
+    if (auto sc = get_size_class(aligned_size); sc < cache_size_classes) {
+      auto& shard = get_cache_shard();
+      std::unique_lock lock(shard.m_mutex);
+      auto& bin = shard.m_bins[sc];
+      if (!bin.empty()) {
+        auto blk = bin.back();
+        bin.pop_back();
+        lock.unlock();
+
+        add_used_mem(aligned_size);
+        sub_mem->init(blk.node->m_memory, size, blk.offset);
+        memory_database::instance().insert(reinterpret_cast<uint64_t>(ptr),
+                                           sub_mem->get_size(), sub_mem);
+        return;
+      }
+    }
+
+    std::lock_guard lock(m_mutex);
+
+    // find first node with a free block that fits
+    auto alloc_from_nodes = [&] {
+      for (auto& mm : m_list) {
+        auto offset = mm->alloc(aligned_size);
+        if (offset == tlsf_allocator::npos)
           continue;
-        }
 
-        auto free_slot = mm->m_free_list;
-        auto alloc_slot = free_slot;
-
-        // find the free slot large enough from the free list (m_free_list), mark it as "not free"
-        // and move it to m_alloc_list
-        while (free_slot != nullptr) {
-          if (free_slot->m_size >= aligned_size) {
-            // found a slot that is large enough
-            if (free_slot->m_size > aligned_size) {
-              // if the slot found is large than require aligned_size, divide it into two slots:
-              // use the first one (alloc_slot) for the current requested allocation
-              // save the other one (free_slot) for future use
-              alloc_slot = free_slot;
-              free_slot = std::make_shared<memory_pool_slot>(alloc_slot->start() + aligned_size, alloc_slot->m_size - aligned_size);
-
-              // update m_free_list,remove alloc_slot from double linked m_free_list
-              if (free_slot->m_prev == nullptr) {
-                mm->m_free_list = free_slot;
-              }
-              else {
-                free_slot->m_prev->m_next = free_slot;
-              }
-              if (free_slot->m_next) {
-                free_slot->m_next->m_prev = free_slot;
-              }
-
-              alloc_slot->m_is_free = false;
-              alloc_slot->m_size = aligned_size;
-            }
-            else {
-              // if the free slot found has exactly the same size as required aligned_size
-              // there is no need to divide the slot, just remove the slot from m_free_list
-              alloc_slot = free_slot;
-              dlinkedlist_delete(mm->m_free_list, alloc_slot);
-              alloc_slot->m_is_free = false;
-            }
-
-            // move the newly found slot to m_alloc_list
-            dlinkedlist_insert(mm->m_alloc_list, alloc_slot);
-
-            // keep track of the total allocated size
-            mm->m_used += alloc_slot->m_size;
-            m_used_mem_current += alloc_slot->m_size;
-            m_used_mem_high = m_used_mem_current;
-
-            // init the sub_mem with bo/offset fro the newly found slot
-            sub_mem->init(mm->m_memory, size, alloc_slot->m_start);
-            memory_database::instance().insert(reinterpret_cast<uint64_t>(ptr),
-                                                            sub_mem->get_size(), sub_mem);
-            return;
-          }
-          free_slot = free_slot->m_next;
-        }
+        add_used_mem(aligned_size);
 
-        mp_itr++;
-        mm = *mp_itr;
-      }
-      
-      // we have already tried enlarging the pool and still no free slot is found
-      if (num_tries == 2)
-        break;
-      
-      if (m_auto_extend) {
-        // no free slot has been found, add one additional block to the pool and try one more time
-        if (extend_memory_pool(aligned_size) == false) {
-          // enlarging pool failed
-          break;
-        }
+        // init the sub_mem with bo/offset for the newly allocated block
+        sub_mem->init(mm->m_memory, size, offset);
+        memory_database::instance().insert(reinterpret_cast<uint64_t>(ptr),
+                                           sub_mem->get_size(), sub_mem);
+        return true;
       }
+      return false;
     };
 
+    if (alloc_from_nodes())
+      return;
+
+    // no free block has been found, add one additional block to the
+    // pool and try one more time
+    if (m_auto_extend && extend_memory_pool(aligned_size) && alloc_from_nodes())
+      return;
+
+    // blocks kept in the thread caches keep their nodes busy, return
+    // them to their nodes before giving up
+    flush_cache();
+    if (alloc_from_nodes())
+      return;
+
     // allocation failed
     return;
   }
@@ -367,50 +296,67 @@ namespace xrt::core::hip
     if (!ptr || m_list.size() == 0)
       return;
 
-    std::lock_guard lock(m_mutex);
+    std::unique_lock lock(m_mutex);
 
     uint64_t start = 0;
     auto mm = find_memory_pool_node(reinterpret_cast<void*>(ptr), start);
-    if (mm != nullptr)
-    {
-      // return the slot to free_list and merge it with ajacent free slot
-      auto size_freed = mm->free(start);
-      m_used_mem_current -= size_freed;
+    if (mm != nullptr) {
+      auto block_size = mm->get_block_size(start);
+
+      // keep small blocks in the cache of the calling thread if there is room
+      bool cached = false;
+      if (auto sc = get_size_class(block_size); sc < cache_size_classes) {
+        lock.unlock();
+        auto& shard = get_cache_shard();
+        std::lock_guard shard_lock(shard.m_mutex);
+        auto& bin = shard.m_bins[sc];
+        if (bin.size() < cache_depth) {
+          bin.push_back({mm.get(), start});
+          cached = true;
+        }
+      }
+
+      if (!cached) {
+        if (!lock.owns_lock())
+          lock.lock();
+        block_size = mm->free(start);
+      }
+
+      m_used_mem_current -= block_size;
     }
 
     memory_database::instance().remove(reinterpret_cast<uint64_t>(ptr));
   }
 
   // trim memory pool by releasing unused blocks back to system until
-  // either total size < min_bytes_to_hold or there is no more blocks to free
+  // either total size <= min_bytes_to_hold or there is no more blocks to free
   void
   memory_pool::trim_to(size_t min_bytes_to_hold)
   {
-    if (m_reserved_mem_current < min_bytes_to_hold)
+    std::lock_guard lock(m_mutex);
+
+    if (m_reserved_mem_current <= min_bytes_to_hold)
       return;
 
-    std::lock_guard lock(m_mutex);
+    // cached blocks keep their nodes busy
+    flush_cache();
 
-    bool node_deleted = false;
-    do {
-      node_deleted = false;
-      auto itr = m_list.begin();
-      while (itr != m_list.end()) {
-        // delete pool block if it is free
-        auto node = *itr;
-        if (node->m_alloc_list == nullptr) {
-          m_reserved_mem_current -= node->get_size();
-          m_list.remove(node);
-          node_deleted = true;
-          break;
-        }
-        ++ itr;
-      };
-    } while (node_deleted && m_reserved_mem_current >= min_bytes_to_hold);
+    auto itr = m_list.begin();
+    while (itr != m_list.end() && m_reserved_mem_current > min_bytes_to_hold) {
+      auto& node = *itr;
+      if (!node->is_free()) {
+        ++itr;
+        continue;
+      }
+      m_reserved_mem_current -= node->get_size();
+      itr = m_list.erase(itr);
+    }
   }
 
   // trim memory pool by releasing unused blocks back to system until
-  // either total size < m_release_threshold (set by user) or there is no more blocks to free
+  // either total size <= m_release_threshold (set by user) or there is no
+  // more blocks to free.  This is a no-op while the reserved memory is
+  // within the threshold, in which case cached blocks are retained.
   void
   memory_pool::purge()
   {
@@ -1,12 +1,15 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024-2025 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 #ifndef xrthip_memory_POOL_h
 #define xrthip_memory_POOL_h
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <list>
 #include <map>
 #include <mutex>
+#include <vector>
 
 #include "core/common/device.h"
 #include "core/include/xrt/xrt_bo.h"
@@ -14,6 +17,7 @@
 
 #include "device.h"
 #include "memory.h"
+#include "tlsf.h"
 
 namespace xrt::core::hip
 {
@@ -24,73 +28,51 @@ namespace xrt::core::hip
   // opaque memory pool handle
   using mem_pool_handle = void*;
 
-  class memory_pool_slot
+  // class memory_pool_node - one device buffer sub-allocated by the pool
+  //
+  // Free and allocated ranges of the buffer are tracked by a TLSF
+  // allocator, allocation and free are O(1) independent of the
+  // fragmentation of the node.
+  class memory_pool_node
   {
   public:
-    memory_pool_slot(size_t start, size_t size);
-
-    size_t start() { return m_start; }
-    size_t end() { return m_start + m_size; }
-    
-    bool
-    is_free()
-    {
-      return m_is_free;
-    }
+    memory_pool_node(device* device, size_t size, int id);
 
-    std::shared_ptr<memory_pool_slot>
-    prev()
+    size_t
+    get_size() const
     {
-      return m_prev;
+      return m_memory->get_size();
     }
 
-    std::shared_ptr<memory_pool_slot>
-    next()
+    // allocate aligned_size bytes, return offset or tlsf_allocator::npos
+    size_t
+    alloc(size_t aligned_size)
     {
-      return m_next;
+      return m_allocator.allocate(aligned_size);
     }
 
+    // return number of bytes freed
     size_t
-    get_size() const
+    free(size_t start)
     {
-      return m_size;
+      return m_allocator.deallocate(start);
     }
 
-    void
-    set_size(size_t size)
+    size_t
+    get_block_size(size_t start) const
     {
-      m_size = size;
+      return m_allocator.block_size(start);
     }
 
-    size_t m_start;
-    size_t m_size;
-    std::shared_ptr<memory_pool_slot> m_prev;
-    std::shared_ptr<memory_pool_slot> m_next;
-    bool m_is_free;
-  };
-
-  class memory_pool_node
-  {
-  public:
-    memory_pool_node(device* device, size_t size, int id);
-
-    size_t
-    get_size() const
+    bool
+    is_free() const
     {
-      return m_memory->get_size();
+      return m_allocator.empty();
     }
 
-    size_t
-    free(size_t start);
-
-    void
-    merge_free_slots(std::shared_ptr<memory_pool_slot> new_free_slot);
-
     int m_id;
-    size_t m_used;    
     std::shared_ptr<memory> m_memory;
-    std::shared_ptr<memory_pool_slot> m_free_list;
-    std::shared_ptr<memory_pool_slot> m_alloc_list;
+    tlsf_allocator m_allocator;
   };
 
   class memory_pool
@@ -139,6 +121,42 @@ namespace xrt::core::hip
     std::shared_ptr<memory_pool_node>
     find_memory_pool_node(void* ptr, uint64_t &start);
 
+    // Small blocks freed by the application are kept in a cache shard
+    // selected by the calling thread and handed out again by malloc
+    // from the same thread without taking the pool mutex.  Cached blocks
+    // remain allocated in their node until the cache is flushed, which
+    // is done when trimming the pool or when no node has room for an
+    // allocation.
+    static constexpr size_t cache_shards = 16;
+    static constexpr size_t cache_size_classes = 16;  // 1 .. 16 pages
+    static constexpr size_t cache_depth = 32;         // blocks per size class
+
+    struct cached_block
+    {
+      memory_pool_node* node;
+      size_t offset;
+    };
+
+    struct cache_shard
+    {
+      std::mutex m_mutex;
+      std::array<std::vector<cached_block>, cache_size_classes> m_bins;
+    };
+
+    cache_shard&
+    get_cache_shard();
+
+    // return size class of aligned_size or cache_size_classes if not cached
+    size_t
+    get_size_class(size_t aligned_size) const;
+
+    // return all cached blocks to their nodes, caller must hold m_mutex
+    void
+    flush_cache();
+
+    void
+    add_used_mem(size_t size);
+
     device* m_device;
     int m_last_id;
     bool m_auto_extend;
@@ -146,6 +164,8 @@ namespace xrt::core::hip
     size_t m_pool_size;
     std::list<std::shared_ptr<memory_pool_node>> m_list;
     std::mutex m_mutex;
+    std::array<cache_shard, cache_shards> m_cache;
+    size_t m_page_size;
 
     int m_reuse_follow_event_dependencies;
     int m_reuse_allow_opportunistic;
@@ -153,8 +173,8 @@ namespace xrt::core::hip
     uint64_t m_release_threshold; // Amount of reserved memory in bytes to hold onto before trying to release memory back to the OS.
     uint64_t m_reserved_mem_current; // Amount of backing memory currently allocated for the mempool.
     uint64_t m_reserved_mem_high; // High watermark of backing memory allocated for the mempool since the last time it was reset.
-    uint64_t m_used_mem_current; //  Amount of memory from the pool that is currently in use by the application.
-    uint64_t m_used_mem_high; // High watermark of the amount of memory from the pool that was in use
+    std::atomic<uint64_t> m_used_mem_current; //  Amount of memory from the pool that is currently in use by the application.
+    std::atomic<uint64_t> m_used_mem_high; // High watermark of the amount of memory from the pool that was in use
   }; 
 
   // The pointer to a memory_pool object is shared between memory_pool_db and mem_pool_cache.
@@ -1,9 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2024-2026 Advanced Micro Devices, Inc. All rights reserved.
 #ifndef xrthip_stream_h
 #define xrthip_stream_h
 
 #include "context.h"
+#include "copy_engine.h"
 
 #include <list>
 
@@ -23,6 +24,9 @@ class stream
   std::mutex m_cmd_lock;
   event* m_top_event{nullptr};
 
+  // Orders asynchronous copies of this stream in the copy engine
+  std::shared_ptr<copy_engine::copy_strand> m_copy_strand{std::make_shared<copy_engine::copy_strand>()};
+
 public:
   stream() = default;
   stream(std::shared_ptr<context> ctx, unsigned int flags, bool is_null = false);
@@ -70,6 +74,12 @@ public:
 
   void
   record_top_event(event* ev);
+
+  const std::shared_ptr<copy_engine::copy_strand>&
+  get_copy_strand() const
+  {
+    return m_copy_strand;
+  }
 };
 
 // Global map of streams
@@ -0,0 +1,347 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef xrthip_tlsf_h
+#define xrthip_tlsf_h
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#ifdef _MSC_VER
+# include <intrin.h>
+#endif
+
+namespace xrt::core::hip {
+
+// class tlsf_allocator - Two-level segregated fit range allocator
+//
+// Manages offsets within a contiguous range of 'capacity' bytes in
+// units of 'granularity' bytes.  The allocator does not touch the
+// managed memory, block bookkeeping is kept out of band, which makes
+// it suitable for sub-allocating device buffers.
+//
+// Free blocks are kept in size segregated free lists indexed by a
+// first level (power of two) and a second level (linear subdivision
+// of the power of two) index.  Two bitmaps record which lists are
+// non-empty, so both allocate() and deallocate() are O(1).  Freed
+// blocks are coalesced with their physical neighbours immediately.
+//
+// Block records are recycled through an index free list so there is
+// no heap allocation in steady state.  The class is not thread safe.
+class tlsf_allocator
+{
+public:
+  static constexpr size_t npos = ~static_cast<size_t>(0);
+
+private:
+  static constexpr uint32_t nil = ~static_cast<uint32_t>(0);
+  static constexpr unsigned int sl_bits = 4;
+  static constexpr unsigned int sl_count = 1u << sl_bits;
+  static constexpr unsigned int fl_count = 64 - sl_bits + 1;
+
+  struct block
+  {
+    size_t offset = 0;          // in granules
+    size_t size = 0;            // in granules
+    uint32_t prev_phys = nil;   // physically adjacent blocks
+    uint32_t next_phys = nil;
+    uint32_t prev_free = nil;   // segregated free list links
+    uint32_t next_free = nil;
+    bool free = false;
+  };
+
+  size_t m_granularity;
+  size_t m_capacity;            // in granules
+  size_t m_used = 0;            // in granules
+
+  std::vector<block> m_blocks;
+  std::vector<uint32_t> m_unused;     // recycled block record indices
+  std::vector<uint32_t> m_offset_map; // granule offset -> block index of allocated blocks
+
+  uint64_t m_fl_bitmap = 0;
+  std::array<uint32_t, fl_count> m_sl_bitmap {};
+  std::array<std::array<uint32_t, sl_count>, fl_count> m_heads;
+
+  static unsigned int
+  msb(uint64_t value)
+  {
+#ifdef _MSC_VER
+    unsigned long idx = 0;
+    _BitScanReverse64(&idx, value);
+    return static_cast<unsigned int>(idx);
+#else
+    return 63 - static_cast<unsigned int>(__builtin_clzll(value));
+#endif
+  }
+
+  static unsigned int
+  lsb(uint64_t value)
+  {
+#ifdef _MSC_VER
+    unsigned long idx = 0;
+    _BitScanForward64(&idx, value);
+    return static_cast<unsigned int>(idx);
+#else
+    return static_cast<unsigned int>(__builtin_ctzll(value));
+#endif
+  }
+
+  static void
+  mapping_insert(size_t size, unsigned int& fl, unsigned int& sl)
+  {
+    if (size < sl_count) {
+      fl = 0;
+      sl = static_cast<unsigned int>(size);
+      return;
+    }
+    auto bit = msb(size);
+    fl = bit - sl_bits + 1;
+    sl = static_cast<unsigned int>(size >> (bit - sl_bits)) ^ sl_count;
+  }
+
+  // Round up to the next list such that any block in the list fits
+  static void
+  mapping_search(size_t size, unsigned int& fl, unsigned int& sl)
+  {
+    if (size >= sl_count)
+      size += (static_cast<size_t>(1) << (msb(size) - sl_bits)) - 1;
+    mapping_insert(size, fl, sl);
+  }
+
+  uint32_t
+  new_block()
+  {
+    if (!m_unused.empty()) {
+      auto idx = m_unused.back();
+      m_unused.pop_back();
+      m_blocks[idx] = block{};
+      return idx;
+    }
+    m_blocks.emplace_back();
+    return static_cast<uint32_t>(m_blocks.size() - 1);
+  }
+
+  void
+  release_block(uint32_t idx)
+  {
+    m_unused.push_back(idx);
+  }
+
+  void
+  insert_free(uint32_t idx)
+  {
+    auto& b = m_blocks[idx];
+    unsigned int fl = 0, sl = 0;
+    mapping_insert(b.size, fl, sl);
+    auto head = m_heads[fl][sl];
+    b.free = true;
+    b.prev_free = nil;
+    b.next_free = head;
+    if (head != nil)
+      m_blocks[head].prev_free = idx;
+    m_heads[fl][sl] = idx;
+    m_fl_bitmap |= (1ULL << fl);
+    m_sl_bitmap[fl] |= (1u << sl);
+  }
+
+  void
+  remove_free(uint32_t idx)
+  {
+    auto& b = m_blocks[idx];
+    unsigned int fl = 0, sl = 0;
+    mapping_insert(b.size, fl, sl);
+    if (b.prev_free != nil)
+      m_blocks[b.prev_free].next_free = b.next_free;
+    else
+      m_heads[fl][sl] = b.next_free;
+    if (b.next_free != nil)
+      m_blocks[b.next_free].prev_free = b.prev_free;
+
+    if (m_heads[fl][sl] == nil) {
+      m_sl_bitmap[fl] &= ~(1u << sl);
+      if (!m_sl_bitmap[fl])
+        m_fl_bitmap &= ~(1ULL << fl);
+    }
+    b.free = false;
+    b.prev_free = b.next_free = nil;
+  }
+
+  uint32_t
+  find_free(size_t size)
+  {
+    unsigned int fl = 0, sl = 0;
+    mapping_search(size, fl, sl);
+    if (fl >= fl_count)
+      return nil;
+
+    uint32_t sl_map = m_sl_bitmap[fl] & (~0u << sl);
+    if (!sl_map) {
+      auto fl_map = (fl + 1 < 64) ? (m_fl_bitmap & (~0ULL << (fl + 1))) : 0;
+      if (!fl_map)
+        return nil;
+      fl = lsb(fl_map);
+      sl_map = m_sl_bitmap[fl];
+    }
+    return m_heads[fl][lsb(sl_map)];
+  }
+
+  // Merge block 'next' into block 'idx', both must be physically adjacent
+  void
+  absorb(uint32_t idx, uint32_t next)
+  {
+    auto& b = m_blocks[idx];
+    auto& n = m_blocks[next];
+    b.size += n.size;
+    b.next_phys = n.next_phys;
+    if (n.next_phys != nil)
+      m_blocks[n.next_phys].prev_phys = idx;
+    release_block(next);
+  }
+
+public:
+  tlsf_allocator(size_t capacity, size_t granularity)
+    : m_granularity(granularity)
+    , m_capacity(capacity / granularity)
+    , m_offset_map(m_capacity, nil)
+  {
+    if (!granularity || !m_capacity)
+      throw std::invalid_argument("tlsf_allocator: invalid capacity or granularity");
+
+    for (auto& fl : m_heads)
+      fl.fill(nil);
+
+    auto idx = new_block();
+    m_blocks[idx].size = m_capacity;
+    insert_free(idx);
+  }
+
+  // Allocate 'bytes' bytes rounded up to the granularity.
+  // Return offset in bytes or npos if no free block fits.
+  size_t
+  allocate(size_t bytes)
+  {
+    auto size = (bytes + m_granularity - 1) / m_granularity;
+    if (!size)
+      size = 1;
+
+    auto idx = find_free(size);
+    if (idx == nil)
+      return npos;
+
+    remove_free(idx);
+
+    // Split off the remainder as a new free block
+    if (m_blocks[idx].size > size) {
+      auto rem = new_block();
+      auto& b = m_blocks[idx]; // new_block may reallocate
+      auto& r = m_blocks[rem];
+      r.offset = b.offset + size;
+      r.size = b.size - size;
+      r.prev_phys = idx;
+      r.next_phys = b.next_phys;
+      if (b.next_phys != nil)
+        m_blocks[b.next_phys].prev_phys = rem;
+      b.next_phys = rem;
+      b.size = size;
+      insert_free(rem);
+    }
+
+    auto& b = m_blocks[idx];
+    m_offset_map[b.offset] = idx;
+    m_used += b.size;
+    return b.offset * m_granularity;
+  }
+
+  // Free block allocated at 'offset' bytes.
+  // Return number of bytes freed, 0 if offset is not allocated.
+  size_t
+  deallocate(size_t offset)
+  {
+    if (offset % m_granularity)
+      return 0;
+
+    auto goff = offset / m_granularity;
+    if (goff >= m_capacity || m_offset_map[goff] == nil)
+      return 0;
+
+    auto idx = m_offset_map[goff];
+    m_offset_map[goff] = nil;
+    auto freed = m_blocks[idx].size;
+    m_used -= freed;
+
+    auto next = m_blocks[idx].next_phys;
+    if (next != nil && m_blocks[next].free) {
+      remove_free(next);
+      absorb(idx, next);
+    }
+
+    auto prev = m_blocks[idx].prev_phys;
+    if (prev != nil && m_blocks[prev].free) {
+      remove_free(prev);
+      absorb(prev, idx);
+      idx = prev;
+    }
+
+    insert_free(idx);
+    return freed * m_granularity;
+  }
+
+  // Size in bytes of block allocated at 'offset', 0 if not allocated
+  size_t
+  block_size(size_t offset) const
+  {
+    auto goff = offset / m_granularity;
+    if ((offset % m_granularity) || goff >= m_capacity || m_offset_map[goff] == nil)
+      return 0;
+    return m_blocks[m_offset_map[goff]].size * m_granularity;
+  }
+
+  size_t
+  capacity() const
+  {
+    return m_capacity * m_granularity;
+  }
+
+  size_t
+  used() const
+  {
+    return m_used * m_granularity;
+  }
+
+  bool
+  empty() const
+  {
+    return m_used == 0;
+  }
+
+  // Size of largest free block in bytes
+  size_t
+  largest_free() const
+  {
+    if (!m_fl_bitmap)
+      return 0;
+
+    auto fl = msb(m_fl_bitmap);
+    size_t largest = 0;
+    for (auto idx = m_heads[fl][msb(m_sl_bitmap[fl])]; idx != nil; idx = m_blocks[idx].next_free)
+      largest = std::max(largest, m_blocks[idx].size);
+    return largest * m_granularity;
+  }
+
+  // External fragmentation in [0, 1]: 1 - largest free / total free
+  double
+  fragmentation() const
+  {
+    auto free_bytes = capacity() - used();
+    if (!free_bytes)
+      return 0.0;
+    return 1.0 - static_cast<double>(largest_free()) / static_cast<double>(free_bytes);
+  }
+};
+
+} // xrt::core::hip
+
+#endif
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -20,6 +20,7 @@
 #include "core/common/config_reader.h"
 #include "xdp/profile/database/database.h"
 #include "xdp/profile/plugin/vp_base/vp_base_plugin.h"
+#include "xdp/profile/writer/vp_base/chrome_trace_writer.h"
 #include "xdp/profile/writer/vp_base/summary_writer.h"
 
 namespace xdp {
@@ -32,6 +33,9 @@ namespace xdp {
     VPDatabase::live = true ;
 
     summary = std::make_unique<SummaryWriter>("summary.csv", this);
+
+    if (xrt_core::config::get_chrome_trace())
+      chromeTrace = std::make_unique<ChromeTraceWriter>("chrome_trace.json", this);
   }
 
   // The database and all the plugins are singletons and can be
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -32,6 +32,7 @@ namespace xdp {
 
   // Forward declarations
   class XDPPlugin ;
+  class ChromeTraceWriter ;
 
   // There will be one database per application, regardless of how
   //  many plugins are created.  All plugins will have a reference to
@@ -61,6 +62,10 @@ namespace xdp {
     // The database itself keeps track of the generic summary
     std::unique_ptr<VPWriter> summary;
 
+    // When enabled, the trace writers of all plugins also add their
+    //  events to one trace in Chrome JSON format
+    std::unique_ptr<ChromeTraceWriter> chromeTrace;
+
     // Additionally, for summary generation, the database must expose
     //  what plugins were loaded and what information is available
     uint64_t pluginInfo ;
@@ -83,6 +88,7 @@ namespace xdp {
     inline VPStatisticsDatabase& getStats()       { return stats ; }
     inline VPStaticDatabase&     getStaticInfo()  { return staticdb ; }
     inline VPDynamicDatabase&    getDynamicInfo() { return dyndb ; }
+    inline ChromeTraceWriter*    getChromeTrace() { return chromeTrace.get() ; }
 
     // Functions that plugins call on startup and destruction
     inline void registerPlugin(XDPPlugin* p)   { plugins.push_back(p) ; }
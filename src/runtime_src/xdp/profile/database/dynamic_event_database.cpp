@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -200,6 +200,19 @@ namespace xdp {
     return device_db->moveEvents();
   }
 
+  std::unique_ptr<EventMerge>
+  VPDynamicDatabase::mergeUnsortedHostEvents(std::function<bool(VTFEvent*)> filter)
+  {
+    return host->mergeUnsortedEvents(filter);
+  }
+
+  std::unique_ptr<EventMerge>
+  VPDynamicDatabase::mergeDeviceEvents(uint64_t deviceId)
+  {
+    auto device_db = getDeviceDB(deviceId);
+    return device_db->mergeEvents();
+  }
+
   void VPDynamicDatabase::setCounterResults(const uint64_t deviceId,
                                             xrt_core::uuid uuid,
                                             xdp::CounterResults& values)
@@ -338,6 +351,25 @@ namespace xdp {
     return device_db->isPLTraceBufferFull();
   }
 
+  void VPDynamicDatabase::setPLTraceOverflow(uint64_t deviceId, uint64_t overflows,
+                                             uint64_t droppedPackets)
+  {
+    auto device_db = getDeviceDB(deviceId);
+    device_db->setPLTraceOverflow(overflows, droppedPackets);
+  }
+
+  uint64_t VPDynamicDatabase::getPLTraceOverflows(uint64_t deviceId)
+  {
+    auto device_db = getDeviceDB(deviceId);
+    return device_db->getPLTraceOverflows();
+  }
+
+  uint64_t VPDynamicDatabase::getPLTraceDroppedPackets(uint64_t deviceId)
+  {
+    auto device_db = getDeviceDB(deviceId);
+    return device_db->getPLTraceDroppedPackets();
+  }
+
   void VPDynamicDatabase::
   setPLDeadlockInfo(uint64_t deviceId, const std::string& info)
   {
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -142,6 +142,12 @@ namespace xdp {
     XDP_CORE_EXPORT std::vector<VTFEvent*> moveUnsortedHostEvents(std::function<bool(VTFEvent*)> filter);
     XDP_CORE_EXPORT std::vector<std::unique_ptr<VTFEvent>> moveDeviceEvents(uint64_t deviceId);
 
+    // Erase events from db and transfer ownership to caller one event
+    // at a time in timestamp order.  Events spilled to disk are read
+    // back as they are reached instead of all at once.
+    XDP_CORE_EXPORT std::unique_ptr<EventMerge> mergeUnsortedHostEvents(std::function<bool(VTFEvent*)> filter);
+    XDP_CORE_EXPORT std::unique_ptr<EventMerge> mergeDeviceEvents(uint64_t deviceId);
+
     XDP_CORE_EXPORT bool deviceEventsExist(uint64_t deviceId);
     XDP_CORE_EXPORT bool hostEventsExist(std::function<bool(VTFEvent*)> filter);
 
@@ -155,6 +161,10 @@ namespace xdp {
     inline void dumpStringTable(std::ofstream& fout)
     { stringTable.dumpTable(fout); }
 
+    // For writers that need the strings themselves instead of their ids
+    inline void lookupStringTable(std::vector<std::string>& strings)
+    { stringTable.lookupTable(strings); }
+
     // OpenCL mappings and dependencies
     XDP_CORE_EXPORT void addOpenCLMapping(uint64_t openclID, uint64_t eventID, uint64_t startID) ;
     XDP_CORE_EXPORT std::pair<uint64_t, uint64_t>
@@ -188,6 +198,11 @@ namespace xdp {
     XDP_CORE_EXPORT void setPLTraceBufferFull(uint64_t deviceId, bool val);
     XDP_CORE_EXPORT bool isPLTraceBufferFull(uint64_t deviceId);
 
+    // Device Trace Buffer Overflows and dropped trace packets - PL
+    XDP_CORE_EXPORT void setPLTraceOverflow(uint64_t deviceId, uint64_t overflows, uint64_t droppedPackets);
+    XDP_CORE_EXPORT uint64_t getPLTraceOverflows(uint64_t deviceId);
+    XDP_CORE_EXPORT uint64_t getPLTraceDroppedPackets(uint64_t deviceId);
+
     // Deadlock Diagnosis metadata
     XDP_CORE_EXPORT void setPLDeadlockInfo(uint64_t deviceId, const std::string& str);
     XDP_CORE_EXPORT std::string getPLDeadlockInfo();
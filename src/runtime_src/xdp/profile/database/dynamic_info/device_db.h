@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -63,6 +63,9 @@ namespace xdp {
     inline std::vector<std::unique_ptr<VTFEvent>> moveEvents()
     { return pl_db.moveEvents(); }
 
+    inline std::unique_ptr<EventMerge> mergeEvents()
+    { return pl_db.mergeEvents(); }
+
     inline void markStart(uint64_t monitorId, const DeviceEventInfo& info)
     {  pl_db.markStart(monitorId, info);  }
 
@@ -78,6 +81,13 @@ namespace xdp {
 
     inline bool isPLTraceBufferFull() { return pl_db.isPLTraceBufferFull(); }
 
+    inline void setPLTraceOverflow(uint64_t overflows, uint64_t droppedPackets)
+    { pl_db.setPLTraceOverflow(overflows, droppedPackets); }
+
+    inline uint64_t getPLTraceOverflows() { return pl_db.getPLTraceOverflows(); }
+    inline uint64_t getPLTraceDroppedPackets()
+    { return pl_db.getPLTraceDroppedPackets(); }
+
     inline void setPLCounterResults(xrt_core::uuid uuid, CounterResults& values)
     { pl_db.setPLCounterResults(uuid, values); }
     inline CounterResults getPLCounterResults(xrt_core::uuid uuid)
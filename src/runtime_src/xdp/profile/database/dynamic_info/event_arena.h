@@ -0,0 +1,112 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef EVENT_ARENA_DOT_H
+#define EVENT_ARENA_DOT_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace xdp {
+
+  // Forward declarations
+  class VTFEvent;
+
+  // An append-only list of events written by a single thread and
+  // drained by a single (other) thread at a time.  Events are stored in
+  // a chain of fixed size slabs.  Appending an event is a store and a
+  // release of the slab count, with no lock, except when a slab is full
+  // and a new slab is linked in.  Draining takes all events appended
+  // since the previous drain, in append order, and frees slabs that
+  // have been completely drained.
+  class EventArena
+  {
+  public:
+    static constexpr size_t slabSize = 1024;
+
+  private:
+    struct Slab
+    {
+      std::array<VTFEvent*, slabSize> events;
+      std::atomic<size_t> count{0};
+      std::atomic<Slab*> next{nullptr};
+    };
+
+    Slab* head;           // Oldest slab not completely drained, drainer only
+    Slab* tail;           // Slab being appended to, writer only
+    size_t drained = 0;   // Events drained from head, drainer only
+
+  public:
+    EventArena() : head(new Slab), tail(head) {}
+
+    ~EventArena()
+    {
+      while (head) {
+        auto next = head->next.load(std::memory_order_relaxed);
+        delete head;
+        head = next;
+      }
+    }
+
+    EventArena(const EventArena&) = delete;
+    EventArena& operator=(const EventArena&) = delete;
+
+    // Called by the writer thread only.  Returns true if the event
+    // started a new slab, which lets callers count events per slab.
+    bool append(VTFEvent* event)
+    {
+      bool newSlab = false;
+      auto count = tail->count.load(std::memory_order_relaxed);
+      if (count == slabSize) {
+        auto slab = new Slab;
+        tail->next.store(slab, std::memory_order_release);
+        tail = slab;
+        count = 0;
+        newSlab = true;
+      }
+      tail->events[count] = event;
+      tail->count.store(count + 1, std::memory_order_release);
+      return newSlab;
+    }
+
+    // Called by one drainer at a time, concurrently with the writer
+    void drain(std::vector<VTFEvent*>& out)
+    {
+      while (true) {
+        auto count = head->count.load(std::memory_order_acquire);
+        out.insert(out.end(), head->events.begin() + drained,
+                   head->events.begin() + count);
+        drained = count;
+        if (count < slabSize)
+          return;
+
+        // The writer is done with a full slab once the next slab is
+        // linked in
+        auto next = head->next.load(std::memory_order_acquire);
+        if (!next)
+          return;
+        delete head;
+        head = next;
+        drained = 0;
+      }
+    }
+  };
+
+} // end namespace xdp
+
+#endif
@@ -0,0 +1,308 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#define XDP_CORE_SOURCE
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+#include "core/common/config_reader.h"
+#include "core/common/message.h"
+
+#include "xdp/profile/database/dynamic_info/event_spill.h"
+#include "xdp/profile/database/events/device_events.h"
+#include "xdp/profile/database/events/native_events.h"
+
+namespace xdp {
+
+  // Fewer events than this per chunk would make the merge of the
+  // chunks read the spill file in very small pieces
+  static constexpr uint64_t minimumSpillEvents = 1024;
+
+  // Parse the trace_memory_limit option, like "512M", "2G" or "65536"
+  static uint64_t memoryLimitBytes()
+  {
+    std::string value = xrt_core::config::get_trace_memory_limit();
+
+    uint64_t bytes = 0;
+    size_t pos = 0;
+    try {
+      bytes = std::stoull(value, &pos);
+    }
+    catch (const std::exception&) {
+      pos = std::string::npos;
+    }
+
+    while (pos < value.size() && std::isspace(static_cast<unsigned char>(value[pos])))
+      ++pos;
+
+    if (pos < value.size()) {
+      switch (std::toupper(static_cast<unsigned char>(value[pos]))) {
+      case 'K': bytes <<= 10; break;
+      case 'M': bytes <<= 20; break;
+      case 'G': bytes <<= 30; break;
+      default:  pos = std::string::npos; break;
+      }
+    }
+
+    if (pos == std::string::npos) {
+      std::string msg = "Unable to parse trace_memory_limit \"" + value
+        + "\".  Trace events will be kept in memory.";
+      xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT", msg);
+      return 0;
+    }
+    return bytes;
+  }
+
+  static bool seek(std::FILE* file, uint64_t offset)
+  {
+#ifdef _WIN32
+    return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+  }
+
+  SpillFile::~SpillFile()
+  {
+    // Temporary files are removed when closed
+    if (file)
+      std::fclose(file);
+  }
+
+  EventSpill::EventSpill(uint64_t eventBytes)
+    : EventSpill(eventBytes, []{ static uint64_t bytes = memoryLimitBytes(); return bytes; }())
+  {
+  }
+
+  EventSpill::EventSpill(uint64_t eventBytes, uint64_t limitBytes)
+  {
+    if (limitBytes != 0)
+      limit = std::max(limitBytes / std::max<uint64_t>(eventBytes, 1), minimumSpillEvents);
+  }
+
+  void EventSpill::spill(std::vector<VTFEvent*>& events)
+  {
+    if (!enabled() || events.empty())
+      return;
+
+    if (!current)
+      current = std::make_unique<SpillFile>();
+    if (!current->file) {
+      current->file = std::tmpfile();
+      if (!current->file) {
+        failed = true;
+        xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT",
+          "Unable to create a temporary file for trace events.  Trace events will be kept in memory.");
+        return;
+      }
+    }
+
+    std::vector<SpillRecord> records;
+    std::vector<VTFEvent*> written;
+    std::vector<VTFEvent*> kept;
+    records.reserve(events.size());
+    written.reserve(events.size());
+    for (auto event : events) {
+      SpillRecord record {};
+      if (event->spill(record)) {
+        records.push_back(record);
+        written.push_back(event);
+      }
+      else
+        kept.push_back(event);
+    }
+    if (records.empty())
+      return;
+
+    // Writes only ever append, a merge that reads the file first
+    // takes it over
+    if (std::fwrite(records.data(), sizeof(SpillRecord), records.size(), current->file) != records.size()
+        || std::fflush(current->file) != 0) {
+      failed = true;
+      xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT",
+        "Unable to write trace events to a temporary file.  Trace events will be kept in memory.");
+      return;
+    }
+
+    current->chunks.push_back({current->records, records.size()});
+    current->records += records.size();
+
+    for (auto event : written)
+      delete event;
+    events = std::move(kept);
+  }
+
+  VTFEvent* EventSpill::restore(const SpillRecord& record)
+  {
+    auto type = static_cast<VTFEventType>(record.type);
+    VTFEvent* event = nullptr;
+    APICall* call = nullptr;
+    VTFDeviceEvent* deviceEvent = nullptr;
+
+    switch (record.kind) {
+    case SPILL_NATIVE_API_CALL:
+      event = call = new NativeAPICall(record.startId, record.timestamp, record.name);
+      break;
+    case SPILL_NATIVE_SYNC_READ:
+      event = call = new NativeSyncRead(record.startId, record.timestamp, record.name);
+      break;
+    case SPILL_NATIVE_SYNC_WRITE:
+      event = call = new NativeSyncWrite(record.startId, record.timestamp, record.name);
+      break;
+    case SPILL_DEVICE_EVENT:
+      event = deviceEvent =
+        new VTFDeviceEvent(record.startId, record.timestamp, type, record.deviceId,
+                           record.monitorId);
+      break;
+    case SPILL_KERNEL_EVENT:
+      event = deviceEvent =
+        new KernelEvent(record.startId, record.timestamp, type, record.deviceId,
+                        record.monitorId, record.cuId);
+      break;
+    case SPILL_KERNEL_STALL:
+      event = deviceEvent =
+        new KernelStall(record.startId, record.timestamp, type, record.deviceId,
+                        record.monitorId, record.cuId);
+      break;
+    case SPILL_DEVICE_MEMORY_ACCESS:
+      event = deviceEvent =
+        new DeviceMemoryAccess(record.startId, record.timestamp, type, record.deviceId,
+                               record.monitorId, record.cuId, record.name);
+      break;
+    case SPILL_DEVICE_STREAM_ACCESS:
+      event = deviceEvent =
+        new DeviceStreamAccess(record.startId, record.timestamp, type, record.deviceId,
+                               record.monitorId, record.cuId);
+      break;
+    case SPILL_HOST_READ:
+      event = deviceEvent =
+        new HostRead(record.startId, record.timestamp, record.deviceId, record.monitorId);
+      break;
+    case SPILL_HOST_WRITE:
+      event = deviceEvent =
+        new HostWrite(record.startId, record.timestamp, record.deviceId, record.monitorId);
+      break;
+    case SPILL_XCLBIN_END:
+      event = deviceEvent =
+        new XclbinEnd(record.startId, record.timestamp, record.deviceId, record.monitorId);
+      break;
+    default:
+      return nullptr;
+    }
+
+    event->setEventId(record.id);
+    if (call)
+      call->setThreadIndex(record.threadIndex);
+    if (deviceEvent)
+      deviceEvent->setDeviceTimestamp(record.deviceTimestamp);
+    return event;
+  }
+
+  EventMerge::EventMerge(std::unique_ptr<SpillFile> spilledEvents,
+                         std::vector<VTFEvent*> memoryEvents,
+                         std::function<bool (VTFEvent*)> filterFn,
+                         std::function<void (VTFEvent*)> rejectFn)
+    : spilled(std::move(spilledEvents))
+    , memory(std::move(memoryEvents))
+    , filter(std::move(filterFn))
+    , reject(std::move(rejectFn))
+  {
+    if (spilled) {
+      cursors.reserve(spilled->chunks.size());
+      for (auto& chunk : spilled->chunks)
+        cursors.push_back({chunk.offset, chunk.offset + chunk.count, {}, 0});
+    }
+
+    for (size_t source = 0; source < cursors.size(); ++source) {
+      if (fill(cursors[source]))
+        push(source);
+    }
+    if (!memory.empty())
+      push(cursors.size());
+  }
+
+  EventMerge::~EventMerge()
+  {
+    for (size_t i = memoryPosition; i < memory.size(); ++i)
+      delete memory[i];
+  }
+
+  // Read the next records of a chunk into its buffer
+  bool EventMerge::fill(Cursor& cursor)
+  {
+    cursor.buffer.clear();
+    cursor.position = 0;
+    if (cursor.next >= cursor.end)
+      return false;
+
+    auto count = std::min<uint64_t>(bufferRecords, cursor.end - cursor.next);
+    if (!seek(spilled->file, cursor.next * sizeof(SpillRecord))) {
+      cursor.next = cursor.end;
+      return false;
+    }
+
+    cursor.buffer.resize(count);
+    auto read = std::fread(cursor.buffer.data(), sizeof(SpillRecord), count, spilled->file);
+    cursor.buffer.resize(read);
+    cursor.next = (read == count) ? cursor.next + count : cursor.end;
+    return read != 0;
+  }
+
+  void EventMerge::push(size_t source)
+  {
+    if (source < cursors.size()) {
+      auto& cursor = cursors[source];
+      heads.push({cursor.buffer[cursor.position].timestamp, source});
+    }
+    else
+      heads.push({memory[memoryPosition]->getTimestamp(), source});
+  }
+
+  std::unique_ptr<VTFEvent> EventMerge::next()
+  {
+    while (!heads.empty()) {
+      auto source = heads.top().source;
+      heads.pop();
+
+      if (source == cursors.size()) {
+        auto event = memory[memoryPosition++];
+        if (memoryPosition < memory.size())
+          push(source);
+        return std::unique_ptr<VTFEvent>(event);
+      }
+
+      auto& cursor = cursors[source];
+      auto event = EventSpill::restore(cursor.buffer[cursor.position]);
+      if (++cursor.position < cursor.buffer.size() || fill(cursor))
+        push(source);
+
+      if (!event)
+        continue;
+      if (filter && !filter(event)) {
+        if (reject)
+          reject(event);
+        else
+          delete event;
+        continue;
+      }
+      return std::unique_ptr<VTFEvent>(event);
+    }
+    return nullptr;
+  }
+
+} // end namespace xdp
@@ -0,0 +1,187 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef EVENT_SPILL_DOT_H
+#define EVENT_SPILL_DOT_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <vector>
+
+#include "xdp/config.h"
+
+namespace xdp {
+
+  // Forward declarations
+  class VTFEvent;
+
+  // The event classes that can be spilled to disk and reconstructed
+  enum SpillKind : uint32_t {
+    SPILL_NONE                 = 0,
+    SPILL_NATIVE_API_CALL      = 1,
+    SPILL_NATIVE_SYNC_READ     = 2,
+    SPILL_NATIVE_SYNC_WRITE    = 3,
+    SPILL_DEVICE_EVENT         = 4,
+    SPILL_KERNEL_EVENT         = 5,
+    SPILL_KERNEL_STALL         = 6,
+    SPILL_DEVICE_MEMORY_ACCESS = 7,
+    SPILL_DEVICE_STREAM_ACCESS = 8,
+    SPILL_HOST_READ            = 9,
+    SPILL_HOST_WRITE           = 10,
+    SPILL_XCLBIN_END           = 11
+  };
+
+  // The fixed size binary record of an event spilled to disk.  Only
+  // the fields needed to reconstruct the spillable event classes are
+  // stored.
+  struct SpillRecord
+  {
+    uint64_t id;
+    uint64_t startId;
+    double   timestamp;
+    uint64_t deviceId;
+    uint64_t deviceTimestamp;
+    uint64_t name;       // Function name or memory name string
+    uint16_t type;       // VTFEventType
+    uint16_t kind;       // SpillKind
+    uint32_t monitorId;
+    uint32_t threadIndex; // Host thread of a native API call
+    int32_t  cuId;
+  };
+  static_assert(sizeof(SpillRecord) == 64, "spill records are 64 bytes");
+
+  // A temporary file of spilled events.  Each spill appends a chunk of
+  // records in timestamp order.  The file is deleted when closed.
+  struct SpillFile
+  {
+    struct Chunk
+    {
+      uint64_t offset; // First record of the chunk
+      uint64_t count;
+    };
+
+    std::FILE* file = nullptr;
+    uint64_t records = 0;
+    std::vector<Chunk> chunks;
+
+    SpillFile() = default;
+    SpillFile(const SpillFile&) = delete;
+    SpillFile& operator=(const SpillFile&) = delete;
+    ~SpillFile();
+  };
+
+  // Continuous flush of a stream of events to disk.  The owning
+  // database spills its events once it holds more than the memory
+  // ceiling set by the xrt.ini option trace_memory_limit allows.
+  // Spilled events are read back only by an EventMerge, when the
+  // trace is written, so memory use does not depend on the length of
+  // the run.  Callers serialize all accesses other than enabled().
+  class EventSpill
+  {
+  private:
+    uint64_t limit = 0;              // Events held in memory before spilling
+    std::atomic<bool> failed{false}; // No temporary file could be written
+    std::unique_ptr<SpillFile> current;
+
+  public:
+    // The memory ceiling is converted to a number of events using
+    // the approximate memory an event takes in the owning database.
+    // A limit of 0 disables spilling.
+    XDP_CORE_EXPORT explicit EventSpill(uint64_t eventBytes);
+    XDP_CORE_EXPORT EventSpill(uint64_t eventBytes, uint64_t limitBytes);
+
+    inline bool enabled() const { return limit != 0 && !failed; }
+    inline uint64_t threshold() const { return limit; }
+    inline bool empty() const { return !current || current->chunks.empty(); }
+
+    // Write the events, which must be in timestamp order, to disk as
+    // one chunk and delete them.  Events that cannot be spilled are
+    // left in the vector.
+    XDP_CORE_EXPORT void spill(std::vector<VTFEvent*>& events);
+
+    // Hand over all chunks spilled so far, new spills go to a new file
+    inline std::unique_ptr<SpillFile> take() { return std::move(current); }
+
+    // Reconstruct an event from its record
+    XDP_CORE_EXPORT static VTFEvent* restore(const SpillRecord& record);
+  };
+
+  // Merge of the chunks of a spill file with events still in memory,
+  // returning one event at a time in timestamp order.  Events with the
+  // same timestamp are returned in the order they were added.  Only a
+  // small buffer of records per chunk is held in memory.
+  class EventMerge
+  {
+  private:
+    static constexpr size_t bufferRecords = 1024;
+
+    struct Cursor
+    {
+      uint64_t next;  // Next record to read from the file
+      uint64_t end;
+      std::vector<SpillRecord> buffer;
+      size_t position = 0;
+    };
+
+    struct Head
+    {
+      double timestamp;
+      size_t source;  // Chunk index, memory events are last
+
+      bool operator>(const Head& rhs) const
+      {
+        return timestamp > rhs.timestamp
+          || (timestamp == rhs.timestamp && source > rhs.source);
+      }
+    };
+
+    std::unique_ptr<SpillFile> spilled;
+    std::vector<Cursor> cursors;
+    std::vector<VTFEvent*> memory;  // In timestamp order
+    size_t memoryPosition = 0;
+    std::priority_queue<Head, std::vector<Head>, std::greater<Head>> heads;
+
+    std::function<bool (VTFEvent*)> filter;
+    std::function<void (VTFEvent*)> reject;
+
+    bool fill(Cursor& cursor);
+    void push(size_t source);
+
+  public:
+    // The events in memory must be in timestamp order and already
+    // filtered.  Spilled events that do not pass the filter are handed
+    // to reject, which takes ownership of them.
+    XDP_CORE_EXPORT
+    EventMerge(std::unique_ptr<SpillFile> spilledEvents,
+               std::vector<VTFEvent*> memoryEvents,
+               std::function<bool (VTFEvent*)> filterFn = nullptr,
+               std::function<void (VTFEvent*)> rejectFn = nullptr);
+    XDP_CORE_EXPORT ~EventMerge();
+
+    EventMerge(const EventMerge&) = delete;
+    EventMerge& operator=(const EventMerge&) = delete;
+
+    // The next event in timestamp order, or nullptr at the end
+    XDP_CORE_EXPORT std::unique_ptr<VTFEvent> next();
+  };
+
+} // end namespace xdp
+
+#endif
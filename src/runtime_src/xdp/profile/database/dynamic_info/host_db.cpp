@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -19,11 +19,21 @@
 #include "xdp/profile/database/dynamic_info/host_db.h"
 #include "xdp/profile/database/events/vtf_event.h"
 #include <algorithm>
+#include <system_error>
 
 namespace xdp {
 
+  static std::atomic<uint64_t> nextHostDBId{1};
+
+  HostDB::HostDB() : id(nextHostDBId++)
+  {
+  }
+
   HostDB::~HostDB()
   {
+    stopSpillThread();
+    flushArenas();
+
     // Delete sorted events still in the database and not moved
     {
       std::lock_guard<std::mutex> lock(sortedLock);
@@ -40,13 +50,84 @@ namespace xdp {
     }
   }
 
+  // Return the arenas of the calling thread, claiming released arenas
+  // or creating new arenas on the first event of a thread
+  HostDB::ThreadArenas& HostDB::threadArenas()
+  {
+    struct Cache
+    {
+      uint64_t dbId = 0;
+      std::shared_ptr<ThreadArenas> arenas;
+
+      ~Cache()
+      {
+        if (arenas)
+          arenas->owned.store(false, std::memory_order_release);
+      }
+    };
+    thread_local Cache cache;
+
+    if (cache.dbId == id)
+      return *cache.arenas;
+
+    if (cache.arenas)
+      cache.arenas->owned.store(false, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(arenaLock);
+    std::shared_ptr<ThreadArenas> claimed;
+    for (auto& a : arenas) {
+      bool expected = false;
+      if (a->owned.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        claimed = a;
+        break;
+      }
+    }
+    if (!claimed) {
+      claimed = std::make_shared<ThreadArenas>();
+      arenas.push_back(claimed);
+    }
+
+    cache.dbId = id;
+    cache.arenas = std::move(claimed);
+    return *cache.arenas;
+  }
+
+  // Merge the events in all arenas into the sorted and unsorted
+  // containers.  Sorted events are inserted in timestamp order; events
+  // with the same timestamp keep the order in which a thread added them.
+  void HostDB::flushArenas()
+  {
+    std::lock_guard<std::mutex> lock(arenaLock);
+
+    std::vector<VTFEvent*> sorted;
+    std::vector<VTFEvent*> unsorted;
+    for (auto& a : arenas) {
+      a->sorted.drain(sorted);
+      a->unsorted.drain(unsorted);
+    }
+
+    if (!sorted.empty()) {
+      std::stable_sort(sorted.begin(), sorted.end(), [](VTFEvent* lhs, VTFEvent* rhs) {
+        return lhs->getTimestamp() < rhs->getTimestamp();
+      });
+
+      std::lock_guard<std::mutex> sortLock(sortedLock);
+      for (auto event : sorted)
+        sortedEvents.emplace_hint(sortedEvents.end(), event->getTimestamp(), event);
+    }
+
+    if (!unsorted.empty()) {
+      std::lock_guard<std::mutex> unsortLock(unsortedLock);
+      unsortedEvents.insert(unsortedEvents.end(), unsorted.begin(), unsorted.end());
+    }
+  }
+
   void HostDB::addSortedEvent(VTFEvent* event)
   {
     if (event == nullptr)
       return;
 
-    std::lock_guard<std::mutex> lock(sortedLock);
-    sortedEvents.emplace(event->getTimestamp(), event);
+    threadArenas().sorted.append(event);
   }
 
   void HostDB::addUnsortedEvent(VTFEvent* event)
@@ -54,12 +135,87 @@ namespace xdp {
     if (event == nullptr)
       return;
 
+    if (threadArenas().unsorted.append(event) && unsortedSpill.enabled()) {
+      // Only the thread that takes the count over the threshold spills
+      auto count = unsortedCount.fetch_add(EventArena::slabSize) + EventArena::slabSize;
+      if (count >= unsortedSpill.threshold()
+          && count - EventArena::slabSize < unsortedSpill.threshold())
+        requestSpill();
+    }
+  }
+
+  // Signal the spill thread, starting it on the first request.  If
+  // no thread can be started, the calling thread spills.
+  void HostDB::requestSpill()
+  {
+    {
+      std::lock_guard<std::mutex> lock(spillLock);
+      if (!spillStop) {
+        try {
+          if (!spillThread.joinable())
+            spillThread = std::thread(&HostDB::spillLoop, this);
+          spillRequested = true;
+          spillCondition.notify_one();
+          return;
+        }
+        catch (const std::system_error&) {
+        }
+      }
+    }
+    spillUnsortedEvents();
+  }
+
+  void HostDB::spillLoop()
+  {
+    std::unique_lock<std::mutex> lock(spillLock);
+    while (true) {
+      spillCondition.wait(lock, [this] { return spillRequested || spillStop; });
+      if (spillStop)
+        return;
+
+      spillRequested = false;
+      lock.unlock();
+      spillUnsortedEvents();
+      lock.lock();
+    }
+  }
+
+  // Pending spill requests are dropped, the events are still in
+  // memory or already spilled
+  void HostDB::stopSpillThread()
+  {
+    {
+      std::lock_guard<std::mutex> lock(spillLock);
+      spillStop = true;
+      spillCondition.notify_one();
+    }
+    if (spillThread.joinable())
+      spillThread.join();
+  }
+
+  // Spill the unsorted events to disk in timestamp order.  Events
+  // are fully constructed, including their timestamp, before they are
+  // added, so they can be read here without synchronizing with the
+  // threads that created them.
+  void HostDB::spillUnsortedEvents()
+  {
+    flushArenas();
+
     std::lock_guard<std::mutex> lock(unsortedLock);
-    unsortedEvents.push_back(event);
+
+    std::stable_sort(unsortedEvents.begin(), unsortedEvents.end(), [](VTFEvent* lhs, VTFEvent* rhs) {
+      return lhs->getTimestamp() < rhs->getTimestamp();
+    });
+
+    // Events that could not be spilled stay in memory
+    unsortedSpill.spill(unsortedEvents);
+    unsortedCount = 0;
   }
 
   bool HostDB::sortedEventsExist(std::function<bool (VTFEvent*)>& filter)
   {
+    flushArenas();
+
     std::lock_guard<std::mutex> lock(sortedLock);
     for (auto& iter : sortedEvents) {
       auto event = iter.second;
@@ -72,6 +228,8 @@ namespace xdp {
   std::vector<VTFEvent*>
   HostDB::filterSortedEvents(std::function<bool (VTFEvent*)>& filter)
   {
+    flushArenas();
+
     std::lock_guard<std::mutex> lock(sortedLock);
 
     std::vector<VTFEvent*> collected;
@@ -86,6 +244,8 @@ namespace xdp {
   std::vector<VTFEvent*>
   HostDB::filterUnsortedEvents(std::function<bool (VTFEvent*)>& filter)
   {
+    flushArenas();
+
     std::lock_guard<std::mutex> lock(unsortedLock);
 
     std::vector<VTFEvent*> collected;
@@ -99,6 +259,8 @@ namespace xdp {
   std::vector<std::unique_ptr<VTFEvent>>
   HostDB::moveSortedEvents(std::function<bool (VTFEvent*)>& filter)
   {
+    flushArenas();
+
     std::lock_guard<std::mutex> lock(sortedLock);
 
     std::vector<std::unique_ptr<VTFEvent>> collected;
@@ -118,22 +280,49 @@ namespace xdp {
   std::vector<VTFEvent*>
   HostDB::moveUnsortedEvents(std::function<bool (VTFEvent*)>& filter)
   {
-    std::lock_guard<std::mutex> lock(unsortedLock);
+    // This reads any spilled events back into memory
+    auto merge = mergeUnsortedEvents(filter);
 
     std::vector<VTFEvent*> collected;
+    while (auto event = merge->next())
+      collected.push_back(event.release());
+    return collected;
+  }
 
-    auto newEnd = std::remove_if(unsortedEvents.begin(), unsortedEvents.end(), [&filter, &collected](VTFEvent* event) {
-        if (filter(event)) {
-            collected.push_back(event);
-            return true;  // Mark the event for removal from unsortedEvents vector
-        }
-        return false; // Keep event in the unsortedEvents vector
-    });
+  std::unique_ptr<EventMerge>
+  HostDB::mergeUnsortedEvents(std::function<bool (VTFEvent*)>& filter)
+  {
+    flushArenas();
+
+    std::vector<VTFEvent*> collected;
+    std::unique_ptr<SpillFile> spilled;
+    {
+      std::lock_guard<std::mutex> lock(unsortedLock);
 
-    // Resize the UnsortedEvents vector to keep only the remaining unfiltered events
-    unsortedEvents.erase(newEnd, unsortedEvents.end());
+      auto newEnd = std::remove_if(unsortedEvents.begin(), unsortedEvents.end(), [&filter, &collected](VTFEvent* event) {
+          if (filter(event)) {
+              collected.push_back(event);
+              return true;  // Mark the event for removal from unsortedEvents vector
+          }
+          return false; // Keep event in the unsortedEvents vector
+      });
 
-    return collected;
+      // Resize the UnsortedEvents vector to keep only the remaining unfiltered events
+      unsortedEvents.erase(newEnd, unsortedEvents.end());
+
+      spilled = unsortedSpill.take();
+    }
+
+    std::stable_sort(collected.begin(), collected.end(), [](VTFEvent* lhs, VTFEvent* rhs) {
+      return lhs->getTimestamp() < rhs->getTimestamp();
+    });
+
+    // Spilled events that do not fit the filter go back to memory
+    return std::make_unique<EventMerge>(std::move(spilled), std::move(collected), filter,
+      [this](VTFEvent* event) {
+        std::lock_guard<std::mutex> lock(unsortedLock);
+        unsortedEvents.push_back(event);
+      });
   }
 
 } // end namespace xdp
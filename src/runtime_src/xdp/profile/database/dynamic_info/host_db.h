@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -17,15 +17,20 @@
 #ifndef HOST_DB_DOT_H
 #define HOST_DB_DOT_H
 
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 #include "xdp/config.h"
 #include "xdp/profile/database/dynamic_info/dependency_manager.h"
+#include "xdp/profile/database/dynamic_info/event_arena.h"
+#include "xdp/profile/database/dynamic_info/event_spill.h"
 #include "xdp/profile/database/dynamic_info/mark.h"
 #include "xdp/profile/database/dynamic_info/types.h"
 
@@ -72,8 +77,52 @@ namespace xdp {
     std::mutex sortedLock; // Protects the "sortedEvents" multimap
     std::mutex unsortedLock; // Protects the "unsortedEvents" vector
 
+    // Host events are added from many threads.  Instead of inserting
+    // each event into the containers above under a global lock, each
+    // thread appends its events to its own arenas.  The arenas are
+    // merged into the containers, sorted events by timestamp, only
+    // when the events are read.  The arenas of a thread that exits are
+    // reused by the next thread that adds events.
+    struct ThreadArenas
+    {
+      EventArena sorted;
+      EventArena unsorted;
+      std::atomic<bool> owned{true};
+    };
+
+    // Identifies this database in the per thread arena lookup
+    const uint64_t id;
+
+    std::vector<std::shared_ptr<ThreadArenas>> arenas;
+    std::mutex arenaLock; // Protects the "arenas" vector and merging
+
+    ThreadArenas& threadArenas();
+    void flushArenas();
+
+    // Approximate memory of a native event and its pointers
+    static constexpr uint64_t unsortedEventBytes = 80;
+
+    // When a trace memory limit is set, unsorted events are spilled to
+    // disk.  The events added since the last spill are counted per
+    // arena slab, so adding an event has no shared write.
+    EventSpill unsortedSpill{unsortedEventBytes}; // Protected by unsortedLock
+    std::atomic<uint64_t> unsortedCount{0};
+    void spillUnsortedEvents();
+
+    // Spilling sorts and writes the events, which is done by a
+    // dedicated thread started on the first spill such that the
+    // application thread crossing the limit only signals the thread.
+    std::thread spillThread;
+    std::mutex spillLock; // Protects the spill thread and its requests
+    std::condition_variable spillCondition;
+    bool spillRequested = false;
+    bool spillStop = false;
+    void requestSpill();
+    void spillLoop();
+    void stopSpillThread();
+
   public:
-    HostDB() = default;
+    XDP_CORE_EXPORT HostDB();
     XDP_CORE_EXPORT ~HostDB();
 
     // Functions to add host events to the database
@@ -107,6 +156,11 @@ namespace xdp {
     std::vector<VTFEvent*>
     moveUnsortedEvents(std::function<bool (VTFEvent*)>& filter);
 
+    // Take all unsorted events that fit the filter, including the
+    // spilled events, to be read one at a time in timestamp order
+    std::unique_ptr<EventMerge>
+    mergeUnsortedEvents(std::function<bool (VTFEvent*)>& filter);
+
     // Functions for matching start events with end events
     inline void registerStart(uint64_t functionId, uint64_t eventId)
     { eventStarts.registerStart(functionId, eventId); }
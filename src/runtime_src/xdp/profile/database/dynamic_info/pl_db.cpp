@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -31,32 +31,64 @@ namespace xdp {
     {
       std::lock_guard<std::mutex> lock(eventLock);
       events.emplace(event->getTimestamp(), event);
-      if (events.size() > eventThreshold)
+      if (spill.enabled()) {
+        if (events.size() >= spill.threshold())
+          spillEvents();
+      }
+      else if (events.size() > eventThreshold)
         overLimit = true;
     }
     if (overLimit)
       VPDatabase::Instance()->broadcast(VPDatabase::DUMP_TRACE);
   }
 
+  // Called with the event lock held.  The multimap is already in
+  // timestamp order, so the events are spilled as one chunk.
+  void PLDB::spillEvents()
+  {
+    std::vector<VTFEvent*> sorted;
+    sorted.reserve(events.size());
+    for (auto& iter : events)
+      sorted.push_back(iter.second);
+    events.clear();
+
+    spill.spill(sorted);
+
+    // Events that could not be spilled stay in memory
+    for (auto event : sorted)
+      events.emplace_hint(events.end(), event->getTimestamp(), event);
+  }
+
   bool PLDB::eventsExist()
   {
     std::lock_guard<std::mutex> lock(eventLock);
-    return !events.empty();
+    return !events.empty() || !spill.empty();
   }
 
   std::vector<std::unique_ptr<VTFEvent>> PLDB::moveEvents()
   {
-    std::lock_guard<std::mutex> lock(eventLock);
+    // This reads any spilled events back into memory
+    auto merge = mergeEvents();
 
     std::vector<std::unique_ptr<VTFEvent>> collected;
-    for (auto iter = events.begin(); iter != events.end(); /* */) {
-      auto event = iter->second;
-      collected.emplace_back(event);
-      iter = events.erase(iter);
-    }
+    while (auto event = merge->next())
+      collected.push_back(std::move(event));
     return collected;
   }
 
+  std::unique_ptr<EventMerge> PLDB::mergeEvents()
+  {
+    std::lock_guard<std::mutex> lock(eventLock);
+
+    std::vector<VTFEvent*> collected;
+    collected.reserve(events.size());
+    for (auto& iter : events)
+      collected.push_back(iter.second);
+    events.clear();
+
+    return std::make_unique<EventMerge>(spill.take(), std::move(collected));
+  }
+
   void PLDB::markStart(uint64_t monitorId, const DeviceEventInfo& info)
   {
     std::lock_guard<std::mutex> lock(startLock);
@@ -109,6 +141,25 @@ namespace xdp {
     return plTraceBufferFull;
   }
 
+  void PLDB::setPLTraceOverflow(uint64_t overflows, uint64_t droppedPackets)
+  {
+    std::lock_guard<std::mutex> lock(fullLock);
+    plTraceOverflows = overflows;
+    plTraceDroppedPackets = droppedPackets;
+  }
+
+  uint64_t PLDB::getPLTraceOverflows()
+  {
+    std::lock_guard<std::mutex> lock(fullLock);
+    return plTraceOverflows;
+  }
+
+  uint64_t PLDB::getPLTraceDroppedPackets()
+  {
+    std::lock_guard<std::mutex> lock(fullLock);
+    return plTraceDroppedPackets;
+  }
+
   void PLDB::setPLCounterResults(xrt_core::uuid uuid, CounterResults& values)
   {
     std::lock_guard<std::mutex> lock(counterLock);
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -25,6 +25,7 @@
 #include "core/common/uuid.h"
 #include "core/include/xdp/counters.h"
 
+#include "xdp/profile/database/dynamic_info/event_spill.h"
 #include "xdp/profile/database/dynamic_info/samples.h"
 #include "xdp/profile/database/dynamic_info/types.h"
 
@@ -47,6 +48,14 @@ namespace xdp {
     // based on the timestamp
     std::multimap<double, VTFEvent*> events;
 
+    // Approximate memory of a device event and its multimap node
+    static constexpr uint64_t eventBytes = 160;
+
+    // When a trace memory limit is set, events are spilled to disk
+    // instead of forcing a flush.  Protected by the event lock.
+    EventSpill spill{eventBytes};
+    void spillEvents();
+
     // Each monitor in the device will have a set of device event starts.
     // This map goes from monitor ID to the list of all the currently
     // outstanding device events we've observed without ends.  We keep this
@@ -60,13 +69,15 @@ namespace xdp {
     std::map<xrt_core::uuid, CounterResults> plCounters;
 
     bool plTraceBufferFull = false; // Is the PL trace buffer full?
+    uint64_t plTraceOverflows = 0;      // Times the trace buffer overflowed
+    uint64_t plTraceDroppedPackets = 0; // Trace packets lost to overflows
 
     SampleContainer powerSamples;
 
     std::mutex eventLock;   // For protecting the events multimap
     std::mutex startLock;   // For protecting the startEvents map
     std::mutex counterLock; // For protecting the plCounters map
-    std::mutex fullLock;    // For protecting the trace buffer full bool
+    std::mutex fullLock;    // For protecting the trace buffer fullness
 
     // Deadlock Diagnosis String
     std::string deadlockInfo;
@@ -80,12 +91,19 @@ namespace xdp {
 
     std::vector<std::unique_ptr<VTFEvent>> moveEvents();
 
+    // Take all events, including the spilled events, to be read one
+    // at a time in timestamp order
+    std::unique_ptr<EventMerge> mergeEvents();
+
     void markStart(uint64_t monitorId, const DeviceEventInfo& info);
     DeviceEventInfo findMatchingStart(uint64_t monitorId, VTFEventType type);
     bool hasMatchingStart(uint64_t monitorId, VTFEventType type);
 
     void setPLTraceBufferFull(bool val);
     bool isPLTraceBufferFull();
+    void setPLTraceOverflow(uint64_t overflows, uint64_t droppedPackets);
+    uint64_t getPLTraceOverflows();
+    uint64_t getPLTraceDroppedPackets();
 
     void setPLCounterResults(xrt_core::uuid uuid, CounterResults& values);
     CounterResults getPLCounterResults(xrt_core::uuid uuid);
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -38,4 +38,16 @@ namespace xdp {
       fout << s.second << "," << s.first.c_str() << "\n";
   }
 
+  void StringTable::lookupTable(std::vector<std::string>& strings)
+  {
+    std::lock_guard<std::mutex> lock(dataLock);
+
+    if (strings.size() == currentId)
+      return;
+
+    strings.resize(currentId);
+    for (auto& s : table)
+      strings[s.second] = s.first;
+  }
+
 } // end namespace xdp
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -22,6 +22,7 @@
 #include <map>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "xdp/config.h"
 
@@ -40,6 +41,10 @@ namespace xdp {
 
     XDP_CORE_EXPORT uint64_t addString(const std::string& value);
     XDP_CORE_EXPORT void dumpTable(std::ofstream& fout);
+
+    // Fill in the strings indexed by their ids.  Nothing is copied if
+    // no string was added since the vector was last filled in.
+    XDP_CORE_EXPORT void lookupTable(std::vector<std::string>& strings);
   };
 
 } // end namespace xdp
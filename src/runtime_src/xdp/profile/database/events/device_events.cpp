@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -19,6 +19,7 @@
 
 #define XDP_CORE_SOURCE
 
+#include "xdp/profile/database/dynamic_info/event_spill.h"
 #include "xdp/profile/database/events/device_events.h"
 #include "xdp/profile/database/static_info_database.h"
 
@@ -56,6 +57,17 @@ namespace xdp {
     fout << std::endl;
   } 
 
+  bool VTFDeviceEvent::spill(SpillRecord& record)
+  {
+    VTFEvent::spill(record) ;
+    record.deviceId        = deviceId ;
+    record.deviceTimestamp = deviceTimestamp ;
+    record.monitorId       = monitorId ;
+    record.cuId            = -1 ;
+    record.kind            = SPILL_DEVICE_EVENT ;
+    return true ;
+  }
+
   KernelEvent::KernelEvent(uint64_t s_id, double ts, VTFEventType ty,
                            uint64_t devId, uint32_t monId, int32_t cuIdx)
              : VTFDeviceEvent(s_id, ts, ty, devId, monId),
@@ -73,6 +85,14 @@ namespace xdp {
     // Don't dump endline.  The writer will add tool tips for this event type
   }
 
+  bool KernelEvent::spill(SpillRecord& record)
+  {
+    VTFDeviceEvent::spill(record) ;
+    record.cuId = cuId ;
+    record.kind = SPILL_KERNEL_EVENT ;
+    return true ;
+  }
+
   KernelStall::KernelStall(uint64_t s_id, double ts, VTFEventType ty,
                            uint64_t devId, uint32_t monId, int32_t cuIdx)
              : KernelEvent(s_id, ts, ty, devId, monId, cuIdx),
@@ -91,6 +111,13 @@ namespace xdp {
     fout << std::endl;
   }
 
+  bool KernelStall::spill(SpillRecord& record)
+  {
+    KernelEvent::spill(record) ;
+    record.kind = SPILL_KERNEL_STALL ;
+    return true ;
+  }
+
   DeviceMemoryAccess::DeviceMemoryAccess(uint64_t s_id, double ts, VTFEventType ty,
                                          uint64_t devId, uint32_t monId, int32_t cuIdx,
                                          uint64_t memStrId)
@@ -113,6 +140,15 @@ namespace xdp {
     fout << "," << memoryName << std::endl;
   }
 
+  bool DeviceMemoryAccess::spill(SpillRecord& record)
+  {
+    VTFDeviceEvent::spill(record) ;
+    record.cuId = cuId ;
+    record.name = memoryName ;
+    record.kind = SPILL_DEVICE_MEMORY_ACCESS ;
+    return true ;
+  }
+
   DeviceStreamAccess::DeviceStreamAccess(uint64_t s_id, double ts, VTFEventType ty,
                                          uint64_t devId, uint32_t monId, int32_t cuIdx)
                     : VTFDeviceEvent(s_id, ts, ty, devId, monId),
@@ -126,6 +162,14 @@ namespace xdp {
   {
   }
 
+  bool DeviceStreamAccess::spill(SpillRecord& record)
+  {
+    VTFDeviceEvent::spill(record) ;
+    record.cuId = cuId ;
+    record.kind = SPILL_DEVICE_STREAM_ACCESS ;
+    return true ;
+  }
+
   HostRead::HostRead(uint64_t s_id, double ts, uint64_t devId, uint32_t monId)
           : VTFDeviceEvent(s_id, ts, HOST_READ, devId, monId)
   {
@@ -135,6 +179,13 @@ namespace xdp {
   {
   }
 
+  bool HostRead::spill(SpillRecord& record)
+  {
+    VTFDeviceEvent::spill(record) ;
+    record.kind = SPILL_HOST_READ ;
+    return true ;
+  }
+
   HostWrite::HostWrite(uint64_t s_id, double ts, uint64_t devId, uint32_t monId)
            : VTFDeviceEvent(s_id, ts, HOST_WRITE, devId, monId)
   {
@@ -144,6 +195,13 @@ namespace xdp {
   {
   }
 
+  bool HostWrite::spill(SpillRecord& record)
+  {
+    VTFDeviceEvent::spill(record) ;
+    record.kind = SPILL_HOST_WRITE ;
+    return true ;
+  }
+
   XclbinEnd::XclbinEnd(uint64_t s_id, double ts, uint64_t devId, uint32_t monId)
     : VTFDeviceEvent(s_id, ts, XCLBIN_END, devId, monId)
   {
@@ -154,4 +212,11 @@ namespace xdp {
   {
   }
 
+  bool XclbinEnd::spill(SpillRecord& record)
+  {
+    VTFDeviceEvent::spill(record) ;
+    record.kind = SPILL_XCLBIN_END ;
+    return true ;
+  }
+
 } // end namespace xdp
@@ -1,5 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -50,6 +51,7 @@ namespace xdp {
     XDP_CORE_EXPORT ~VTFDeviceEvent() ;
 
     XDP_CORE_EXPORT virtual void dump(std::ofstream& fout, uint32_t bucket);
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record);
 
     virtual bool     isDeviceEvent() { return true ; }
     virtual uint64_t getDevice()     { return deviceId ; }
@@ -74,6 +76,7 @@ namespace xdp {
 
     virtual int32_t getCUId() { return cuId; }
     XDP_CORE_EXPORT virtual void dump(std::ofstream& fout, uint32_t bucket) ;
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record);
   };
 
   class KernelStall : public KernelEvent
@@ -87,6 +90,7 @@ namespace xdp {
                            uint64_t devId, uint32_t monId, int32_t cuIdx);
     XDP_CORE_EXPORT ~KernelStall();
     XDP_CORE_EXPORT virtual void dump(std::ofstream& fout, uint32_t bucket);
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record);
   } ;
 
   class DeviceMemoryAccess : public VTFDeviceEvent
@@ -107,6 +111,7 @@ namespace xdp {
     XDP_CORE_EXPORT ~DeviceMemoryAccess();
 
     XDP_CORE_EXPORT virtual void dump(std::ofstream& fout, uint32_t bucket);
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record);
 
     virtual int32_t getCUId() { return cuId; }
 
@@ -127,6 +132,8 @@ namespace xdp {
                                   uint64_t devId, uint32_t monId, int32_t cuIdx = -1);
     XDP_CORE_EXPORT ~DeviceStreamAccess();
 
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record);
+
     virtual int32_t getCUId() { return cuId; }
   } ;
 
@@ -137,6 +144,7 @@ namespace xdp {
   public:
     XDP_CORE_EXPORT HostRead(uint64_t s_id, double ts, uint64_t devId, uint32_t monId) ;
     XDP_CORE_EXPORT ~HostRead() ;
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record);
   } ;
 
   class HostWrite : public VTFDeviceEvent
@@ -146,6 +154,7 @@ namespace xdp {
   public:
     XDP_CORE_EXPORT HostWrite(uint64_t s_id, double ts, uint64_t devId, uint32_t monId) ;
     XDP_CORE_EXPORT ~HostWrite() ;
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record);
   } ;
 
   class XclbinEnd : public VTFDeviceEvent
@@ -155,6 +164,7 @@ namespace xdp {
   public:
     XDP_CORE_EXPORT XclbinEnd(uint64_t s_id, double ts, uint64_t devId, uint32_t monId) ;
     XDP_CORE_EXPORT ~XclbinEnd() ;
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record);
   } ;
 
 } // end namespace xdp
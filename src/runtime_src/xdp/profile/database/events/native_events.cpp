@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2021 Xilinx, Inc
- * Copyright (C) 2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -18,6 +18,7 @@
 #define XDP_CORE_SOURCE
 
 #include "xdp/profile/database/database.h"
+#include "xdp/profile/database/dynamic_info/event_spill.h"
 #include "xdp/profile/database/events/native_events.h"
 
 namespace xdp {
@@ -33,6 +34,15 @@ namespace xdp {
     fout << "," << functionName << "\n";
   }
 
+  bool NativeAPICall::spill(SpillRecord& record)
+  {
+    VTFEvent::spill(record);
+    record.name = functionName;
+    record.threadIndex = threadIndex;
+    record.kind = SPILL_NATIVE_API_CALL;
+    return true;
+  }
+
   NativeSyncRead::NativeSyncRead(uint64_t s_id, double ts, uint64_t name) :
     NativeAPICall(s_id, ts, name)
   {
@@ -45,6 +55,13 @@ namespace xdp {
     fout << "," << readStr << "\n";
   }
 
+  bool NativeSyncRead::spill(SpillRecord& record)
+  {
+    NativeAPICall::spill(record);
+    record.kind = SPILL_NATIVE_SYNC_READ;
+    return true;
+  }
+
   NativeSyncWrite::NativeSyncWrite(uint64_t s_id, double ts, uint64_t name) :
     NativeAPICall(s_id, ts, name)
   {
@@ -57,4 +74,11 @@ namespace xdp {
     fout << "," << writeStr << "\n";
   }
 
+  bool NativeSyncWrite::spill(SpillRecord& record)
+  {
+    NativeAPICall::spill(record);
+    record.kind = SPILL_NATIVE_SYNC_WRITE;
+    return true;
+  }
+
 } // end namespace xdp
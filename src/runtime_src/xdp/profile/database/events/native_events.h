@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2021 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -31,6 +31,7 @@ namespace xdp {
     virtual bool isNativeHostEvent() { return true; }
 
     XDP_CORE_EXPORT virtual void dump(std::ofstream& fout, uint32_t bucket);
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record) override;
   };
 
   class NativeSyncRead : public NativeAPICall
@@ -42,6 +43,7 @@ namespace xdp {
     XDP_CORE_EXPORT ~NativeSyncRead() = default;
 
     virtual bool isNativeRead() override { return true; }
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record) override;
 
     // For printing out the event in a different bucket as a different
     //  type of event, without having to store additional events in the database
@@ -57,6 +59,7 @@ namespace xdp {
     XDP_CORE_EXPORT ~NativeSyncWrite() = default;
 
     virtual bool isNativeWrite() override { return true; }
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record) override;
 
     // For printing out the event in a different bucket as a different
     //  type of event, without having to store additional events in the databaes
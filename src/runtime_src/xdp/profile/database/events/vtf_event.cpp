@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -15,11 +15,13 @@
  * under the License.
  */
 
+#include <atomic>
 #include <fstream>
 #include <iomanip>
 
 #define XDP_CORE_SOURCE
 
+#include "xdp/profile/database/dynamic_info/event_spill.h"
 #include "xdp/profile/database/events/vtf_event.h"
 
 namespace xdp {
@@ -45,6 +47,16 @@ namespace xdp {
     dumpType(fout, true) ;    
   }
 
+  bool VTFEvent::spill(SpillRecord& record)
+  {
+    record.id        = id ;
+    record.startId   = start_id ;
+    record.timestamp = timestamp ;
+    record.type      = static_cast<uint16_t>(type) ;
+    record.kind      = SPILL_NONE ;
+    return false ;
+  }
+
   void VTFEvent::dumpTimestamp(std::ofstream& fout)
   {
     // Host events are accurate up to microseconds.
@@ -168,9 +180,19 @@ namespace xdp {
   // API Call definitions
   // **************************
 
+  // Host threads are numbered from 1 in the order they make their
+  // first traced call
+  static uint32_t currentThreadIndex()
+  {
+    static std::atomic<uint32_t> threads{0} ;
+    static thread_local uint32_t index = ++threads ;
+    return index ;
+  }
+
   APICall::APICall(uint64_t s_id, double ts, uint64_t name, VTFEventType ty)
          : VTFEvent(s_id, ts, ty),
-           functionName(name)
+           functionName(name),
+           threadIndex(currentThreadIndex())
   {
   }
 
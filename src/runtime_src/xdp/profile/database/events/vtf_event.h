@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -25,6 +25,9 @@
 
 namespace xdp {
 
+  // Forward declarations
+  struct SpillRecord;
+
   enum VTFEventType {
     // User level events
     USER_MARKER          = 0,
@@ -100,6 +103,7 @@ namespace xdp {
     inline double       getTimestamp()    const { return timestamp ; }
     inline void         setTimestamp(double ts) { timestamp = ts ; }
     inline uint64_t     getEventId()            { return id ; }
+    inline uint64_t     getStartId()            { return start_id ; }
     inline void         setEventId(uint64_t i)  { id = i ; }
     inline VTFEventType getEventType()          { return type; }
 
@@ -136,6 +140,11 @@ namespace xdp {
     virtual uint64_t getDevice() { return 0 ; } // CHECK
     XDP_CORE_EXPORT virtual void dump(std::ofstream& fout, uint32_t bucket) ;
     virtual void dumpSync(std::ofstream& /*fout*/, uint32_t /*bucket*/) {};
+
+    // Fill in the record used when the database spills the event to
+    // disk.  Returns false for events that cannot be reconstructed
+    // from a record and have to stay in memory.
+    XDP_CORE_EXPORT virtual bool spill(SpillRecord& record) ;
   } ;
 
   // Used so the database can sort based on timestamp order
@@ -152,12 +161,17 @@ namespace xdp {
   {
   protected:
     uint64_t functionName ; // An index into the string table
+    uint32_t threadIndex ;  // The host thread that made the call
 
     APICall() = delete ;
   public:
     XDP_CORE_EXPORT APICall(uint64_t s_id, double ts, uint64_t name, VTFEventType ty);
     XDP_CORE_EXPORT ~APICall() ;
 
+    inline uint64_t getFunctionName()            { return functionName ; }
+    inline uint32_t getThreadIndex()             { return threadIndex ; }
+    inline void     setThreadIndex(uint32_t idx) { threadIndex = idx ; }
+
     virtual bool isHostEvent() { return true ; } 
   } ;
  
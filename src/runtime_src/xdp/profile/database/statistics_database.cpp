@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -261,6 +261,38 @@ namespace xdp {
     }
   }
 
+  CallStatistics* VPStatisticsDatabase::getCallStatistics(const std::string& name)
+  {
+    std::lock_guard<std::mutex> lock(callStatisticsLock) ;
+
+    auto& stats = callStatistics[std::make_pair(name, std::this_thread::get_id())] ;
+    if (!stats)
+      stats = std::make_unique<CallStatistics>() ;
+    return stats.get() ;
+  }
+
+  std::map<std::string, CallSummary> VPStatisticsDatabase::getCallSummaries()
+  {
+    std::lock_guard<std::mutex> lock(callStatisticsLock) ;
+
+    // Combine the statistics of all threads for each function
+    std::map<std::string, CallSummary> summaries ;
+    for (const auto& stats : callStatistics) {
+      CallSummary threadSummary = stats.second->summary() ;
+      if (threadSummary.count == 0)
+        continue ;
+
+      CallSummary& summary = summaries[stats.first.first] ;
+      summary.count     += threadSummary.count ;
+      summary.totalTime += threadSummary.totalTime ;
+      if (threadSummary.minTime < summary.minTime)
+        summary.minTime = threadSummary.minTime ;
+      if (threadSummary.maxTime > summary.maxTime)
+        summary.maxTime = threadSummary.maxTime ;
+    }
+    return summaries ;
+  }
+
   void VPStatisticsDatabase::logMemoryTransfer(uint64_t deviceId,
                                                 DeviceMemoryStatistics::ChannelType channelNum,
                                                 size_t count)
@@ -460,6 +492,11 @@ namespace xdp {
       }
     }
 
+    for (const auto& s : getCallSummaries())
+    {
+      counts[s.first] += s.second.count ;
+    }
+
     for (const auto& i : counts)
     {
       fout << i.first << "," << i.second << std::endl ;
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -18,9 +18,12 @@
 #ifndef VP_STATISTICS_DATABASE_DOT_H
 #define VP_STATISTICS_DATABASE_DOT_H
 
+#include <atomic>
 #include <fstream>
+#include <limits>
 #include <list>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -88,6 +91,53 @@ namespace xdp {
 
   } ;
 
+  // The CallSummary struct holds the aggregate information of the calls
+  //  to one API function
+  struct CallSummary
+  {
+    uint64_t count = 0 ;
+    double totalTime = 0 ;
+    double minTime = (std::numeric_limits<double>::max)() ;
+    double maxTime = 0 ;
+  } ;
+
+  // The CallStatistics class aggregates the calls to one API function
+  //  made by one thread.  Only the owning thread updates it, so the
+  //  updates are plain atomic loads and stores without a lock, and
+  //  the summary writer can read it at any time.
+  class CallStatistics
+  {
+  private:
+    std::atomic<uint64_t> count{0} ;
+    std::atomic<double> totalTime{0} ;
+    std::atomic<double> minTime{(std::numeric_limits<double>::max)()} ;
+    std::atomic<double> maxTime{0} ;
+
+  public:
+    void update(double executionTime)
+    {
+      totalTime.store(totalTime.load(std::memory_order_relaxed) + executionTime,
+                      std::memory_order_relaxed) ;
+      if (executionTime < minTime.load(std::memory_order_relaxed))
+        minTime.store(executionTime, std::memory_order_relaxed) ;
+      if (executionTime > maxTime.load(std::memory_order_relaxed))
+        maxTime.store(executionTime, std::memory_order_relaxed) ;
+      // Published last so a reader never sees a count without its time
+      count.store(count.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_release) ;
+    }
+
+    CallSummary summary() const
+    {
+      CallSummary s ;
+      s.count     = count.load(std::memory_order_acquire) ;
+      s.totalTime = totalTime.load(std::memory_order_relaxed) ;
+      s.minTime   = minTime.load(std::memory_order_relaxed) ;
+      s.maxTime   = maxTime.load(std::memory_order_relaxed) ;
+      return s ;
+    }
+  } ;
+
   // The struct BufferTransferStats keeps track of a single buffer transfer
   //  so we can report the top N transfers
   struct BufferTransferStats
@@ -179,6 +229,13 @@ namespace xdp {
     std::map<std::pair<std::string, std::thread::id>,
              std::vector<std::pair<double, double>>> callCount ;
 
+    // Statistics on native API calls are aggregated per function and
+    //  thread as the calls complete.  The lock is only taken when a
+    //  thread calls a function for the first time.
+    std::map<std::pair<std::string, std::thread::id>,
+             std::unique_ptr<CallStatistics>> callStatistics ;
+    std::mutex callStatisticsLock ;
+
     // **** User Level Event Statistics ****
     std::map<std::string, uint64_t> eventCounts ;
     std::map<std::pair<const char*, const char*>, uint64_t> rangeCounts ;
@@ -337,6 +394,11 @@ namespace xdp {
     XDP_CORE_EXPORT void logFunctionCallEnd(const std::string& name, 
                                        double timestamp) ;
 
+    // The aggregate statistics of a function for the calling thread.
+    //  The returned object lives as long as the database.
+    XDP_CORE_EXPORT CallStatistics* getCallStatistics(const std::string& name) ;
+    XDP_CORE_EXPORT std::map<std::string, CallSummary> getCallSummaries() ;
+
     XDP_CORE_EXPORT void logMemoryTransfer(uint64_t deviceId, 
                                       DeviceMemoryStatistics::ChannelType channelType,
                                       size_t byteCount) ;
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2019-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -21,6 +21,9 @@
 #include "xdp/profile/device/pl_device_trace_logger.h"
 #include "xrt/experimental/xrt_profile.h"
 
+#include <algorithm>
+#include <string>
+
 namespace xdp {
 
 PLDeviceTraceOffload::
@@ -33,6 +36,7 @@ PLDeviceTraceOffload
   : dev_intf(dInt)
   , deviceTraceLogger(dTraceLogger)
   , sleep_interval_ms(sleep_interval_ms)
+  , offload_interval_us(sleep_interval_ms * 1000)
   , m_prev_clk_train_time(std::chrono::system_clock::now())
   , m_process_trace(false)
   , m_process_trace_done(false)
@@ -68,11 +72,17 @@ offload_device_continuous()
     return;
   }
 
+  auto last_poll = std::chrono::steady_clock::now();
   while (should_continue()) {
     train_clock();
     // Can't flush datamover in middle of offload
     m_read_trace(false);
-    std::this_thread::sleep_for(std::chrono::milliseconds(sleep_interval_ms));
+
+    auto now = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - last_poll).count();
+    last_poll = now;
+    auto interval = next_offload_interval_us(static_cast<uint64_t>(elapsed));
+    std::this_thread::sleep_for(std::chrono::microseconds(interval));
   }
 
   // Do final forced read
@@ -90,6 +100,39 @@ offload_device_continuous()
   offload_finished();
 }
 
+// Circular buffers are offloaded often enough that the buffer filling
+// up the fastest stays at the target occupancy between polls.  The rate
+// follows an increase right away, but only comes down gradually, so a
+// burst after a quiet period still finds the interval short.  The
+// configured interval is the longest used, as that is what the trace
+// buffer size was checked against.
+uint64_t PLDeviceTraceOffload::
+next_offload_interval_us(uint64_t elapsed_us)
+{
+  uint64_t max_interval_us = sleep_interval_ms * 1000;
+  if (!ts2mm_info.use_circ_buf || max_interval_us == 0)
+    return max_interval_us;
+
+  double rate = poll_fill / static_cast<double>(std::max<uint64_t>(elapsed_us, 1));
+  fill_rate = (rate > fill_rate) ? rate : (fill_rate + rate) / 2;
+  poll_fill = 0.0;
+
+  uint64_t interval = max_interval_us;
+  if (fill_rate > 0.0) {
+    double target = (TS2MM_TARGET_OCCUPANCY_PCT / 100.0) / fill_rate;
+    if (target < static_cast<double>(max_interval_us))
+      interval = std::max<uint64_t>(static_cast<uint64_t>(target), TS2MM_MIN_OFFLOAD_INTERVAL_US);
+  }
+
+  if (interval != offload_interval_us) {
+    debug_stream
+      << "Trace offload interval : " << interval << " us"
+      << " Fill rate : " << fill_rate * 1000000 << " buffers/s" << std::endl;
+    offload_interval_us = interval;
+  }
+  return interval;
+}
+
 void PLDeviceTraceOffload::
 train_clock_continuous()
 {
@@ -127,20 +170,17 @@ process_trace()
 
   bool q_read = false;
   bool q_empty = true;
-  std::unique_ptr<unsigned char[]> buf;
-  uint64_t size = 0;
+  std::vector<unsigned char> buf;
   do {
     q_read=false;
     ts2mm_info.process_queue_lock.lock();
     if (!ts2mm_info.data_queue.empty()) {
       buf = std::move(ts2mm_info.data_queue.front());
-      size = ts2mm_info.size_queue.front();
       ts2mm_info.data_queue.pop();
-      ts2mm_info.size_queue.pop();
       q_read = true;
       q_empty = ts2mm_info.data_queue.empty();
     }
-    if (ts2mm_info.size_queue.size() > TS2MM_QUEUE_SZ_WARN_THRESHOLD) {
+    if (ts2mm_info.data_queue.size() > TS2MM_QUEUE_SZ_WARN_THRESHOLD) {
       std::call_once(ts2mm_queue_warning_flag, [](){
         xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT", TS2MM_WARN_MSG_QUEUE_SZ);
       });
@@ -149,9 +189,19 @@ process_trace()
 
     // Processing takes a lot more time compared to everything else
     if (q_read) {
-      debug_stream << "Process " << size << " bytes of trace" << std::endl;
-      deviceTraceLogger->processTraceData(buf.get(), size) ;
-      buf.reset();
+      debug_stream << "Process " << buf.size() << " bytes of trace" << std::endl;
+      deviceTraceLogger->processTraceData(buf.data(), buf.size()) ;
+
+      // Keep the copy around for the next offload to fill, unless
+      // that would keep too much memory for copies that may not be
+      // needed again
+      std::lock_guard<std::mutex> lock(ts2mm_info.process_queue_lock);
+      if (ts2mm_info.free_buffers.size() < TS2MM_MAX_FREE_BUFFERS
+          && ts2mm_info.free_bytes + buf.capacity() <= TS2MM_MAX_FREE_BYTES) {
+        ts2mm_info.free_bytes += buf.capacity();
+        ts2mm_info.free_buffers.push_back(std::move(buf));
+      }
+      buf = {};
     }
   } while (!q_empty);
 }
@@ -249,8 +299,10 @@ read_trace_fifo(bool)
     auto fifo_size = dev_intf->getFifoSize();
 
     // hw emulation has infinite fifo
-    if ((num_packets >= fifo_size) && (xdp::getFlowMode() == xdp::Flow::HW))
+    if ((num_packets >= fifo_size) && (xdp::getFlowMode() == xdp::Flow::HW)) {
       fifo_full = true;
+      overflow_count++;
+    }
   }
 }
 
@@ -279,6 +331,13 @@ read_trace_end()
   bool isTS2MMFull = (dev_intf->hasTs2mm() && trace_buffer_full()) ? true : false;
   deviceTraceLogger->addEventMarkers(isFIFOFull, isTS2MMFull);
 
+  if (dropped_packets > 0) {
+    std::string msg = "Device trace offload dropped "
+      + std::to_string(dropped_packets) + " trace packets in "
+      + std::to_string(overflow_count) + " trace buffer overflows.";
+    xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT", msg);
+  }
+
   if (dev_intf->hasTs2mm()) {
     reset_s2mm();
     m_initialized = false;
@@ -291,16 +350,32 @@ read_trace_s2mm(bool force)
   for (uint64_t i = 0; i < ts2mm_info.num_ts2mm; i++) {
     auto& bd = ts2mm_info.buffers[i];
 
-    if (bd.offload_done)
+    // Full buffers are still polled to count the trace that didn't fit
+    if (bd.offload_done && !bd.full)
       continue;
 
-    auto bytes_written = dev_intf->getWordCountTs2mm(i, force) * TRACE_PACKET_SIZE;
+    auto word_count = dev_intf->getWordCountTs2mm(i, force);
+    auto bytes_written = word_count * TRACE_PACKET_SIZE;
     auto bytes_read = bd.rollover_count * bd.alloc_size + bd.used_size;
 
+    // Share of the buffer written since the last poll
+    if (word_count > bd.prv_wordcount && bd.alloc_size) {
+      auto fill = static_cast<double>((word_count - bd.prv_wordcount) * TRACE_PACKET_SIZE);
+      poll_fill = std::max(poll_fill, fill / static_cast<double>(bd.alloc_size));
+    }
+    bd.prv_wordcount = word_count;
+
+    if (bd.full) {
+      log_overflow(bd, (bytes_written > bd.alloc_size) ? bytes_written - bd.alloc_size : 0);
+      bd.offload_done = true;
+      continue;
+    }
+
     // Offload cannot keep up with the DMA
     if (bytes_written > bytes_read + bd.alloc_size) {
       // Don't read any data
       bd.offload_done = true;
+      log_overflow(bd, bytes_written - bytes_read);
 
        debug_stream
         << "ts2mm_ " << i << " Reading from 0x"
@@ -386,19 +461,30 @@ sync_and_log(uint64_t index)
   debug_stream
     << "ts2mm_" << index << " : sync : "
     << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
-    << " µs" << " nBytes : " << nBytes << std::endl;
+    << " us" << " nBytes : " << nBytes << std::endl;
 
   if (!host_buf) {
     bd.offload_done = true;
     return false;
   }
 
-  auto tmp = std::make_unique<unsigned char[]>(nBytes);
-  std::memcpy(tmp.get(), host_buf, nBytes);
+  // Copy into an already processed buffer if there is one, as the
+  // device keeps writing to the trace buffer
+  std::vector<unsigned char> data;
+  ts2mm_info.process_queue_lock.lock();
+  if (!ts2mm_info.free_buffers.empty()) {
+    data = std::move(ts2mm_info.free_buffers.back());
+    ts2mm_info.free_buffers.pop_back();
+    ts2mm_info.free_bytes -= data.capacity();
+  }
+  ts2mm_info.process_queue_lock.unlock();
+
+  auto src = static_cast<unsigned char*>(host_buf);
+  data.assign(src, src + nBytes);
+
   // Push new data into queue for processing
   ts2mm_info.process_queue_lock.lock();
-  ts2mm_info.data_queue.push(std::move(tmp));
-  ts2mm_info.size_queue.push(nBytes);
+  ts2mm_info.data_queue.push(std::move(data));
   ts2mm_info.process_queue_lock.unlock();
 
   // Print warning if processing large amount of trace
@@ -413,6 +499,26 @@ sync_and_log(uint64_t index)
   return true;
 }
 
+void PLDeviceTraceOffload::
+log_overflow(TraceBufferInfo& bd, uint64_t dropped_bytes)
+{
+  // A buffer that is exactly full lost nothing, it is an overflow
+  // only once the datamover reports trace that did not fit
+  if (!dropped_bytes)
+    return;
+
+  if (!bd.overflow) {
+    bd.overflow = true;
+    overflow_count++;
+  }
+  // The datamover keeps counting what it could not write, so only the
+  // trace lost since the last poll is added
+  if (dropped_bytes > bd.dropped_bytes) {
+    dropped_packets += (dropped_bytes - bd.dropped_bytes) / TRACE_PACKET_SIZE;
+    bd.dropped_bytes = dropped_bytes;
+  }
+}
+
 bool PLDeviceTraceOffload::
 init_s2mm(bool circ_buf, const std::vector<uint64_t> &buf_sizes)
 {
@@ -473,6 +579,10 @@ reset_s2mm()
     ts2mm_info.buffers[i].bufId = 0;
   }
   ts2mm_info.buffers.clear();
+
+  std::lock_guard<std::mutex> lock(ts2mm_info.process_queue_lock);
+  ts2mm_info.free_buffers.clear();
+  ts2mm_info.free_bytes = 0;
 }
 
 bool PLDeviceTraceOffload::
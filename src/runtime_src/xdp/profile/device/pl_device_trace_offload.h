@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2019-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -35,6 +35,7 @@
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 
 namespace xdp {
 
@@ -57,8 +58,10 @@ struct TraceBufferInfo {
   uint64_t offset;
   uint64_t address;
   uint64_t prv_wordcount;
+  uint64_t dropped_bytes;
   uint32_t rollover_count;
   bool     full;
+  bool     overflow;
   bool     offload_done;
   bool     big_trace_warn_done;
   
@@ -69,8 +72,10 @@ struct TraceBufferInfo {
       offset(0),
       address(0),
       prv_wordcount(0),
+      dropped_bytes(0),
       rollover_count(0),
       full(false),
+      overflow(false),
       offload_done(false),
       big_trace_warn_done(false)
   {}
@@ -89,8 +94,11 @@ struct Ts2mmInfo {
   uint64_t circ_buf_min_rate = TS2MM_DEF_BUF_SIZE * 100;
   uint64_t circ_buf_cur_rate;
 
-  std::queue<std::unique_ptr<unsigned char[]>> data_queue;
-  std::queue<uint64_t> size_queue;
+  // Trace copied out of the device buffers waiting to be processed, and
+  // processed copies kept to be filled again by the next offload
+  std::queue<std::vector<unsigned char>> data_queue;
+  std::vector<std::vector<unsigned char>> free_buffers;
+  size_t free_bytes = 0;
   std::mutex process_queue_lock;
 
   Ts2mmInfo()
@@ -149,6 +157,11 @@ public:
     return ts2mm_info.use_circ_buf;
   };
 
+  // Trace lost because the offload could not keep up with the device
+  // or the trace buffer was full, and the number of times it happened
+  uint64_t get_dropped_packets() { return dropped_packets; }
+  uint64_t get_overflow_count() { return overflow_count; }
+
   inline OffloadThreadStatus get_status() {
     std::lock_guard<std::mutex> lock(status_lock);
     return status;
@@ -169,6 +182,8 @@ private:
   void offload_finished();
   void process_trace_continuous();
   bool sync_and_log(uint64_t index);
+  void log_overflow(TraceBufferInfo& bd, uint64_t dropped_bytes);
+  uint64_t next_offload_interval_us(uint64_t elapsed_us);
 
 protected:
   PLDeviceIntf* dev_intf;
@@ -191,6 +206,17 @@ private:
   std::thread process_thread;
   bool continuous = false;
 
+  // Pacing of continuous offload from circular buffers.  Fill rates are
+  // the share of a trace buffer written per microsecond, of the buffer
+  // filling up the fastest.
+  uint64_t offload_interval_us = 0;
+  double poll_fill = 0.0;
+  double fill_rate = 0.0;
+
+  // Dropped trace
+  std::atomic<uint64_t> dropped_packets{0};
+  std::atomic<uint64_t> overflow_count{0};
+
   // Clock Training Params
   bool m_force_clk_train = true;
   std::chrono::time_point<std::chrono::system_clock> m_prev_clk_train_time;
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  * 
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -51,6 +51,14 @@
 // Read data only if it's more than 512B unless forced
 #define TS2MM_MIN_READ_SIZE      0x200
 #define DEFAULT_TRACE_OFFLOAD_INTERVAL_MS 10
+// Continuous offload from circular buffers polls often enough to keep
+// them half full at the measured trace rate, but not more often than
+// every 100 us
+#define TS2MM_TARGET_OCCUPANCY_PCT 50
+#define TS2MM_MIN_OFFLOAD_INTERVAL_US 100
+// Number and total size of processed trace copies kept for reuse
+#define TS2MM_MAX_FREE_BUFFERS 8
+#define TS2MM_MAX_FREE_BYTES   (TS2MM_DEF_BUF_SIZE * 8)
 // Throw warning when too much trace in processing pipeline
 // Use some arbitrary large number here
 #define TS2MM_QUEUE_SZ_WARN_THRESHOLD 5000
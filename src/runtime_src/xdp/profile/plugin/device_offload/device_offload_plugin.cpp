@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2020-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -429,6 +429,8 @@ namespace xdp {
       return;
     if (device_trace) {
       db->getDynamicInfo().setPLTraceBufferFull(deviceId, offloader->trace_buffer_full());
+      db->getDynamicInfo().setPLTraceOverflow(deviceId, offloader->get_overflow_count(),
+                                              offloader->get_dropped_packets());
     }
   }
 
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -15,13 +15,13 @@
  * under the License.
  */
 
-#include <map>
-#include <mutex>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
 
 #define XDP_PLUGIN_SOURCE
 
 #include "core/common/time.h"
-#include "xdp/profile/database/dynamic_info/types.h"
 #include "xdp/profile/database/events/native_events.h"
 #include "xdp/profile/plugin/native/native_cb.h"
 #include "xdp/profile/plugin/native/native_plugin.h"
@@ -33,9 +33,56 @@ namespace xdp {
   // functions below.
   static NativeProfilingPlugin nativePluginInstance;
 
-  // For logging statistics: Function ID to start timestamp
-  static std::mutex timestampLock;
-  static std::map<uint64_t, uint64_t> nativeTimestamps;
+  // The start and end callbacks of a native API call are made by the
+  // same thread, from the constructor and destructor of a scoped
+  // logger object, so the calls of a thread are nested.  Each thread
+  // matches the ends of its calls with their starts on its own stack
+  // without taking a lock.
+  struct NativeCallStart
+  {
+    uint64_t functionID;
+    uint64_t APIEventId;
+    uint64_t transferEventId; // Sync calls only
+    uint64_t timestamp;       // For statistics
+  };
+
+  static thread_local std::vector<NativeCallStart> callStarts;
+
+  static NativeCallStart matchingCallStart(uint64_t functionID)
+  {
+    // The matching start is on top unless a start was not recorded
+    for (auto iter = callStarts.rbegin(); iter != callStarts.rend(); ++iter) {
+      if (iter->functionID == functionID) {
+        NativeCallStart start = *iter;
+        callStarts.erase(std::next(iter).base());
+        return start;
+      }
+    }
+    return { functionID, 0, 0, 0 };
+  }
+
+  // Each thread aggregates its own statistics of each function.  The
+  // statistics are looked up by the name pointer passed from XRT,
+  // which is the same on every call from the same place.
+  static CallStatistics* callStatistics(VPDatabase* db,
+                                        const char* functionName)
+  {
+    static thread_local std::unordered_map<const char*, CallStatistics*> stats;
+
+    CallStatistics*& functionStats = stats[functionName];
+    if (functionStats == nullptr)
+      functionStats = db->getStats().getCallStatistics(functionName);
+    return functionStats;
+  }
+
+  static void logCallStatistics(VPDatabase* db, const char* functionName,
+                                uint64_t startTimestamp, uint64_t endTimestamp)
+  {
+    if (startTimestamp == 0)
+      return;
+    callStatistics(db, functionName)->
+      update(static_cast<double>(endTimestamp) - static_cast<double>(startTimestamp));
+  }
 
 } // end namespace xdp
 
@@ -50,22 +97,21 @@ void native_function_start(const char* functionName,
 
   // Don't include the profiling overhead in the time that we show.
   // That means there will be "empty gaps" in the timeline trace when
-  // the profiling overhead exists.  That means we create the event
-  // and add it to the database first, and set the timestamp as close as
-  // possible to the true start of the observed function.
+  // the profiling overhead exists.  The function name is added first
+  // and the timestamp is taken as late as possible.  The event must
+  // not be modified once it is added to the database, which may sort
+  // or spill it on another thread, so the timestamp is set when the
+  // event is constructed.
   xdp::VPDatabase* db = xdp::nativePluginInstance.getDatabase();
 
+  auto functionStr = db->getDynamicInfo().addString(functionName);
   xdp::VTFEvent* event =
     new xdp::NativeAPICall(0,
-                           0,
-                           db->getDynamicInfo().addString(functionName));
+                           static_cast<double>(xrt_core::time_ns()),
+                           functionStr);
   db->getDynamicInfo().addUnsortedEvent(event);
-  db->getDynamicInfo().markStart(static_cast<uint64_t>(functionID),
-                                 event->getEventId());
-
-  db->getStats().logFunctionCallStart(functionName,
-                                      static_cast<double>(xrt_core::time_ns()));
-  event->setTimestamp(static_cast<double>(xrt_core::time_ns()));
+  xdp::callStarts.push_back({ static_cast<uint64_t>(functionID),
+                              event->getEventId(), 0, xrt_core::time_ns() });
 }
 
 // In order to not show profiling overhead in the timeline, we have
@@ -82,14 +128,12 @@ void native_function_end(const char* functionName,
     return;
 
   xdp::VPDatabase* db = xdp::nativePluginInstance.getDatabase();
-  db->getStats().logFunctionCallEnd(functionName,
-                                    static_cast<double>(timestamp));
 
-  uint64_t start =
-    db->getDynamicInfo().matchingStart(static_cast<uint64_t>(functionID));
+  auto start = xdp::matchingCallStart(static_cast<uint64_t>(functionID));
+  xdp::logCallStatistics(db, functionName, start.timestamp, timestamp);
 
   xdp::VTFEvent* event =
-    new xdp::NativeAPICall(start,
+    new xdp::NativeAPICall(start.APIEventId,
                            static_cast<double>(timestamp),
                            db->getDynamicInfo().addString(functionName));
   db->getDynamicInfo().addUnsortedEvent(event);
@@ -110,7 +154,9 @@ void native_sync_start(const char* functionName,
   // Don't include the profiling overhead in the time that we show.
   // That means there will be "empty gaps" in the timeline trace when
   // the profiling overhead exists.  We do this by capturing the
-  // timestamp as close to the end of this function as possible
+  // timestamp as late as possible, but before the events are added
+  // to the database where they may be sorted or spilled on another
+  // thread.
   xdp::VPDatabase* db = xdp::nativePluginInstance.getDatabase();
 
   // Create two different events.  One for capturing the API to be put
@@ -119,30 +165,24 @@ void native_sync_start(const char* functionName,
   xdp::VTFEvent* transferEvent = nullptr;
 
   auto functionStr = db->getDynamicInfo().addString(functionName);
-  APIEvent = new xdp::NativeAPICall(0, 0, functionStr);
+  auto start = static_cast<double>(xrt_core::time_ns());
+  APIEvent = new xdp::NativeAPICall(0, start, functionStr);
   if (isWrite)
-    transferEvent = new xdp::NativeSyncWrite(0, 0, functionStr);
+    transferEvent = new xdp::NativeSyncWrite(0, start, functionStr);
   else
-    transferEvent = new xdp::NativeSyncRead(0, 0, functionStr);
+    transferEvent = new xdp::NativeSyncRead(0, start, functionStr);
 
   db->getDynamicInfo().addUnsortedEvent(APIEvent);
   db->getDynamicInfo().addUnsortedEvent(transferEvent);
 
   // We need to store both events for lookup as we will only get one
   // "stop" event from the XRT side for this particular functionID.
-  xdp::EventPair events = { APIEvent->getEventId(), transferEvent->getEventId() };
-  db->getDynamicInfo().markEventPairStart(static_cast<uint64_t>(functionID), events);
-
-  {
-    // For statistics, also keep track of the start time associated with
-    // this data transfer.
-    std::lock_guard<std::mutex> lock(xdp::timestampLock);
-    xdp::nativeTimestamps[static_cast<uint64_t>(functionID)] = xrt_core::time_ns();
-  }
-
-  db->getStats().logFunctionCallStart(functionName, static_cast<double>(xrt_core::time_ns()));
-  APIEvent->setTimestamp(static_cast<double>(xrt_core::time_ns()));
-  transferEvent->setTimestamp(static_cast<double>(xrt_core::time_ns()));
+  // For statistics, also keep track of the start time associated with
+  // this data transfer.
+  xdp::callStarts.push_back({ static_cast<uint64_t>(functionID),
+                              APIEvent->getEventId(),
+                              transferEvent->getEventId(),
+                              xrt_core::time_ns() });
 }
 
 extern "C"
@@ -152,20 +192,12 @@ void native_sync_end(const char* functionName, unsigned long long int functionID
     return;
 
   xdp::VPDatabase* db = xdp::nativePluginInstance.getDatabase();
-  db->getStats().logFunctionCallEnd(functionName, static_cast<double>(timestamp));
-
-  uint64_t startTimestamp = 0;
-  uint64_t transferTime = 0;
-  {
-    std::lock_guard<std::mutex> lock(xdp::timestampLock);
-    startTimestamp = xdp::nativeTimestamps[static_cast<uint64_t>(functionID)];
-    transferTime = timestamp - startTimestamp;
-    xdp::nativeTimestamps.erase(functionID);
-  }
 
   // Retrieve the pair of events for this particular functionID.
-  auto startEvents =
-    db->getDynamicInfo().matchingEventPairStart(static_cast<uint64_t>(functionID));
+  auto startEvents = xdp::matchingCallStart(static_cast<uint64_t>(functionID));
+  uint64_t startTimestamp = startEvents.timestamp;
+  uint64_t transferTime = timestamp - startTimestamp;
+  xdp::logCallStatistics(db, functionName, startTimestamp, timestamp);
 
   xdp::VTFEvent* APIEvent = nullptr;
   xdp::VTFEvent* transferEvent = nullptr;
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -22,6 +22,7 @@
 #include "xdp/profile/database/static_info/pl_constructs.h"
 #include "xdp/profile/database/static_info/xclbin_info.h"
 #include "xdp/profile/plugin/vp_base/utility.h"
+#include "xdp/profile/writer/vp_base/chrome_trace_writer.h"
 #include "xdp/profile/writer/device_trace/device_trace_writer.h"
 
 namespace xdp {
@@ -322,7 +323,9 @@ namespace xdp {
   void DeviceTraceWriter::writeTraceEvents()
   {
     fout << "EVENTS\n";
-    auto DeviceEvents = db->getDynamicInfo().moveDeviceEvents(deviceId);
+    // Events spilled to disk during the run are merged in as they are
+    // written, so they are never all in memory at once
+    auto DeviceEvents = db->getDynamicInfo().mergeDeviceEvents(deviceId);
 
     auto& loadedConfigs =
       (db->getStaticInfo()).getLoadedConfigs(deviceId);
@@ -336,10 +339,19 @@ namespace xdp {
     if (!xclbin)
       return;
 
-    for(auto& e : DeviceEvents) {
+    ChromeTraceWriter* chrome = db->getChromeTrace();
+    uint32_t chromePid = 0;
+    if (chrome)
+      chromePid = chrome->getProcess((db->getStaticInfo()).getDeviceName(deviceId)
+                                     + "-" + std::to_string(deviceId));
+
+    while (auto e = DeviceEvents->next()) {
       VTFDeviceEvent* deviceEvent = dynamic_cast<VTFDeviceEvent*>(e.get());
       if(!deviceEvent)
         continue;
+
+      if (chrome)
+        writeChromeEvent(chrome, chromePid, xclbin, deviceEvent);
       
       int32_t cuId = deviceEvent->getCUId();
       VTFEventType eventType = deviceEvent->getEventType();
@@ -398,6 +410,104 @@ namespace xdp {
       }
     }
 
+    if (chrome)
+      chrome->write(false);
+  }
+
+  // Each row of the device trace is a track of the device process in
+  // the Chrome trace, named after the compute unit or monitor it is for
+  DeviceTraceWriter::ChromeTrack*
+  DeviceTraceWriter::getChromeTrack(ChromeTraceWriter* chrome, uint32_t pid,
+                                    XclbinInfo* xclbin,
+                                    VTFDeviceEvent* deviceEvent)
+  {
+    VTFEventType eventType = deviceEvent->getEventType();
+    bool isCUEvent = (KERNEL == eventType
+                      || KERNEL_STALL_EXT_MEM == eventType
+                      || KERNEL_STALL_DATAFLOW == eventType
+                      || KERNEL_STALL_PIPE == eventType);
+    uint32_t id = isCUEvent ? static_cast<uint32_t>(deviceEvent->getCUId())
+                            : deviceEvent->getMonitorId();
+
+    auto key = std::make_tuple(xclbin, eventType, id);
+    auto iter = chromeTracks.find(key);
+    if (iter != chromeTracks.end())
+      return &(iter->second);
+
+    std::string base;
+    if (isCUEvent) {
+      base = "Compute Unit " + std::to_string(id);
+      for (const auto& cuIter : xclbin->pl.cus) {
+        if (cuIter.second->getAccelMon() == deviceEvent->getCUId())
+          base = cuIter.second->getName();
+      }
+    }
+    else if (KERNEL_READ == eventType || KERNEL_WRITE == eventType) {
+      Monitor* aim = (db->getStaticInfo()).getAIMonitor(deviceId, xclbin, id);
+      base = aim ? aim->name : "AXI Memory Monitor " + std::to_string(id);
+    }
+    else {
+      Monitor* asM = (db->getStaticInfo()).getASMonitor(deviceId, xclbin, id);
+      base = asM ? asM->name : "AXI Stream Monitor " + std::to_string(id);
+    }
+
+    std::string name;
+    switch (eventType) {
+    case KERNEL:
+      name = "Executions";
+      break;
+    case KERNEL_STALL_EXT_MEM:
+      name = "External Memory Stall";
+      break;
+    case KERNEL_STALL_DATAFLOW:
+      name = "Intra-Kernel Dataflow Stall";
+      break;
+    case KERNEL_STALL_PIPE:
+      name = "Inter-Kernel Pipe Stall";
+      break;
+    case KERNEL_READ:
+      name = "Read Channel";
+      break;
+    case KERNEL_WRITE:
+      name = "Write Channel";
+      break;
+    case KERNEL_STREAM_READ:
+    case KERNEL_STREAM_WRITE:
+      name = "Stream Activity";
+      break;
+    case KERNEL_STREAM_READ_STALL:
+    case KERNEL_STREAM_WRITE_STALL:
+      name = "Link Stall";
+      break;
+    case KERNEL_STREAM_READ_STARVE:
+    case KERNEL_STREAM_WRITE_STARVE:
+      name = "Link Starve";
+      break;
+    default:
+      // Host reads and writes and the end of an xclbin have no row
+      return nullptr;
+    }
+
+    ChromeTrack& track = chromeTracks[key];
+    track.tid = chrome->getThread(pid, base + " " + name);
+    track.name = name;
+    return &track;
+  }
+
+  void DeviceTraceWriter::writeChromeEvent(ChromeTraceWriter* chrome,
+                                           uint32_t pid, XclbinInfo* xclbin,
+                                           VTFDeviceEvent* deviceEvent)
+  {
+    ChromeTrack* track = getChromeTrack(chrome, pid, xclbin, deviceEvent);
+    if (track == nullptr)
+      return;
+
+    // Device timestamps are in milliseconds
+    double timestamp = deviceEvent->getTimestamp() * 1.0e6;
+    if (deviceEvent->getStartId() == 0)
+      chrome->begin(pid, track->tid, track->name, timestamp);
+    else
+      chrome->end(pid, track->tid, timestamp);
   }
 
   void DeviceTraceWriter::writeDependencies()
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2024-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -18,7 +18,9 @@
 #ifndef HAL_DEVICE_TRACE_WRITER_DOT_H
 #define HAL_DEVICE_TRACE_WRITER_DOT_H
 
+#include <map>
 #include <string>
+#include <tuple>
 
 #include "xdp/profile/database/database.h"
 #include "xdp/profile/device/pl_device_intf.h"
@@ -26,6 +28,10 @@
 
 namespace xdp {
 
+  // Forward declarations
+  class ChromeTraceWriter ;
+  class VTFDeviceEvent ;
+
   class DeviceTraceWriter : public VPTraceWriter
   {
   private:
@@ -41,6 +47,19 @@ namespace xdp {
 
     uint64_t deviceId;
 
+    // The tracks of the Chrome trace for each row of the device trace
+    struct ChromeTrack
+    {
+      uint32_t tid;
+      std::string name;
+    };
+    std::map<std::tuple<XclbinInfo*, VTFEventType, uint32_t>, ChromeTrack> chromeTracks;
+
+    ChromeTrack* getChromeTrack(ChromeTraceWriter* chrome, uint32_t pid,
+                                XclbinInfo* xclbin, VTFDeviceEvent* deviceEvent);
+    void writeChromeEvent(ChromeTraceWriter* chrome, uint32_t pid,
+                          XclbinInfo* xclbin, VTFDeviceEvent* deviceEvent);
+
     // Helper function for making sure the database has enough information
     //  to print out all of the information it will need.
     void initialize() ;
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2021 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -20,6 +20,7 @@
 #include "xdp/profile/database/database.h"
 #include "xdp/profile/database/events/native_events.h"
 #include "xdp/profile/plugin/vp_base/utility.h"
+#include "xdp/profile/writer/vp_base/chrome_trace_writer.h"
 #include "xdp/profile/writer/native/native_writer.h"
 
 namespace xdp {
@@ -60,22 +61,19 @@ namespace xdp {
 
   void NativeTraceWriter::writeTraceEvents()
   {
-    std::vector<VTFEvent*> APIEvents =
-      (db->getDynamicInfo()).moveUnsortedHostEvents(
+    // The events come in timestamp order.  Events spilled to disk
+    // during the run are merged in as they are written.
+    auto APIEvents =
+      (db->getDynamicInfo()).mergeUnsortedHostEvents(
         [](VTFEvent* e)
         {
           return e->isNativeHostEvent();
         } ) ;
 
-    std::sort(APIEvents.begin(), APIEvents.end(),
-              [](VTFEvent* x, VTFEvent* y)
-                {
-                  if (x->getTimestamp() < y->getTimestamp()) return true;
-                  return false;
-                }) ;
+    ChromeTraceWriter* chrome = db->getChromeTrace();
 
     fout << "EVENTS" << "\n";
-    for (auto& e : APIEvents) {
+    while (auto e = APIEvents->next()) {
       // If this is a read/write, then dump the event in the other bucket
       if (e->isNativeRead())
         e->dumpSync(fout, readBucket);
@@ -83,10 +81,41 @@ namespace xdp {
         e->dumpSync(fout, writeBucket);
       else
         e->dump(fout, APIBucket);
+
+      if (chrome)
+        writeChromeEvent(chrome, e.get());
+    }
+
+    if (chrome)
+      chrome->write(false);
+  }
+
+  void NativeTraceWriter::writeChromeEvent(ChromeTraceWriter* chrome,
+                                           VTFEvent* e)
+  {
+    // Only native API calls pass the filter on the events
+    auto call = static_cast<NativeAPICall*>(e);
+    uint32_t pid = chrome->getHostProcess();
+    bool isStart = (call->getStartId() == 0);
+
+    // API calls nest on the track of the thread that made them, while
+    // the data transfers of sync calls from different threads overlap
+    if (call->isNativeRead() || call->isNativeWrite()) {
+      const char* category = call->isNativeRead() ? "Reads" : "Writes";
+      if (isStart)
+        chrome->asyncBegin(pid, category, call->getFunctionName(),
+                           call->getEventId(), call->getTimestamp());
+      else
+        chrome->asyncEnd(pid, category, call->getFunctionName(),
+                         call->getStartId(), call->getTimestamp());
+      return;
     }
 
-    for (auto& e : APIEvents)
-      delete e;
+    uint32_t tid = chrome->getHostThread(call->getThreadIndex());
+    if (isStart)
+      chrome->begin(pid, tid, call->getFunctionName(), call->getTimestamp());
+    else
+      chrome->end(pid, tid, call->getTimestamp());
   }
 
   void NativeTraceWriter::writeDependencies()
@@ -1,5 +1,6 @@
 /**
  * Copyright (C) 2016-2021 Xilinx, Inc
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -21,6 +22,10 @@
 
 namespace xdp {
 
+  // Forward declarations
+  class ChromeTraceWriter ;
+  class VTFEvent ;
+
   class NativeTraceWriter : public VPTraceWriter
   {
   private:
@@ -30,6 +35,8 @@ namespace xdp {
     const uint32_t readBucket = 2 ;
     const uint32_t writeBucket = 3 ;
 
+    void writeChromeEvent(ChromeTraceWriter* chrome, VTFEvent* e) ;
+
   protected:
     virtual void writeHeader() ;
     virtual void writeStructure() ;
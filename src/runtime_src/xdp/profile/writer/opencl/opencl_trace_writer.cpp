@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -23,6 +23,7 @@
 #include "xdp/profile/database/events/opencl_host_events.h"
 
 #include "xdp/profile/plugin/vp_base/utility.h"
+#include "xdp/profile/writer/vp_base/chrome_trace_writer.h"
 
 namespace xdp {
 
@@ -118,6 +119,8 @@ namespace xdp {
                                                      return e->isOpenCLHostEvent();
                                                    }
                                                  );
+    ChromeTraceWriter* chrome = db->getChromeTrace();
+
     for (auto& e : APIEvents) {
       int bucket = 0 ;
       if (e->isOpenCLAPI() && (dynamic_cast<OpenCLAPICall*>(e.get()) != nullptr)) {
@@ -141,7 +144,53 @@ namespace xdp {
           bucket = generalAPIBucket; // Should never happen
       }
       e->dump(fout, bucket) ;
+
+      if (chrome)
+        writeChromeEvent(chrome, e.get()) ;
     }
+
+    if (chrome)
+      chrome->write(false) ;
+  }
+
+  void OpenCLTraceWriter::writeChromeEvent(ChromeTraceWriter* chrome,
+                                           VTFEvent* e)
+  {
+    uint32_t pid = chrome->getHostProcess() ;
+    bool isStart = (e->getStartId() == 0) ;
+
+    // API calls nest on the track of the thread that made them
+    if (e->isOpenCLAPI()) {
+      OpenCLAPICall* call = dynamic_cast<OpenCLAPICall*>(e) ;
+      if (call == nullptr)
+        return ;
+
+      uint32_t tid = chrome->getHostThread(call->getThreadIndex()) ;
+      if (isStart)
+        chrome->begin(pid, tid, call->getFunctionName(), call->getTimestamp()) ;
+      else
+        chrome->end(pid, tid, call->getTimestamp()) ;
+      return ;
+    }
+
+    // Buffer transfers and kernel enqueues overlap each other
+    const char* category = nullptr ;
+    if (e->isReadBuffer())
+      category = "Read Buffer" ;
+    else if (e->isWriteBuffer())
+      category = "Write Buffer" ;
+    else if (e->isCopyBuffer())
+      category = "Copy Buffer" ;
+    else if (e->isKernelEnqueue())
+      category = "Kernel Enqueue" ;
+    else
+      return ;
+
+    uint64_t name = (db->getDynamicInfo()).addString(category) ;
+    if (isStart)
+      chrome->asyncBegin(pid, category, name, e->getEventId(), e->getTimestamp()) ;
+    else
+      chrome->asyncEnd(pid, category, name, e->getStartId(), e->getTimestamp()) ;
   }
 
   void OpenCLTraceWriter::writeDependencies()
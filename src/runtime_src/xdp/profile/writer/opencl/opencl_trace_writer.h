@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -25,6 +25,10 @@
 
 namespace xdp {
 
+  // Forward declarations
+  class ChromeTraceWriter ;
+  class VTFEvent ;
+
   class OpenCLTraceWriter : public VPTraceWriter
   {
   private:
@@ -45,6 +49,8 @@ namespace xdp {
     //  are missing.
     void collapseDependencyChains(std::map<uint64_t, std::vector<uint64_t>>& d);
 
+    void writeChromeEvent(ChromeTraceWriter* chrome, VTFEvent* e) ;
+
   protected:
     virtual void writeHeader() ;
     virtual void writeStructure() ;
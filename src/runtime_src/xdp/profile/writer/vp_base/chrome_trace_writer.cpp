@@ -0,0 +1,287 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#define XDP_CORE_SOURCE
+
+#include <cmath>
+#include <cstring>
+
+#include "xdp/profile/database/database.h"
+#include "xdp/profile/writer/vp_base/chrome_trace_writer.h"
+
+namespace xdp {
+
+  ChromeTraceWriter::ChromeTraceWriter(const char* filename, VPDatabase* inst)
+    : VPWriter(filename, inst)
+    , buffer(bufferSize)
+  {
+    append("[");
+  }
+
+  ChromeTraceWriter::~ChromeTraceWriter()
+  {
+    std::lock_guard<std::mutex> lock(writeLock);
+    append("\n]\n");
+    flushBuffer();
+    fout.flush();
+  }
+
+  void ChromeTraceWriter::flushBuffer()
+  {
+    if (used == 0)
+      return;
+    fout.write(buffer.data(), static_cast<std::streamsize>(used));
+    used = 0;
+  }
+
+  void ChromeTraceWriter::append(const char* data, size_t size)
+  {
+    if (used + size > buffer.size()) {
+      flushBuffer();
+      if (size > buffer.size()) {
+        fout.write(data, static_cast<std::streamsize>(size));
+        return;
+      }
+    }
+    std::memcpy(buffer.data() + used, data, size);
+    used += size;
+  }
+
+  void ChromeTraceWriter::appendNumber(uint64_t value)
+  {
+    char digits[20];
+    size_t start = sizeof(digits);
+    do {
+      digits[--start] = static_cast<char>('0' + (value % 10));
+      value /= 10;
+    } while (value != 0);
+    append(digits + start, sizeof(digits) - start);
+  }
+
+  // Timestamps in the trace are in microseconds.  Both host and device
+  // timestamps are kept to the nanosecond.
+  void ChromeTraceWriter::appendTimestamp(double nanoseconds)
+  {
+    uint64_t ns = nanoseconds > 0 ? static_cast<uint64_t>(std::llround(nanoseconds)) : 0;
+    appendNumber(ns / 1000);
+
+    uint64_t fraction = ns % 1000;
+    char digits[4] = { '.',
+                       static_cast<char>('0' + fraction / 100),
+                       static_cast<char>('0' + (fraction / 10) % 10),
+                       static_cast<char>('0' + fraction % 10) };
+    append(digits, sizeof(digits));
+  }
+
+  void ChromeTraceWriter::appendString(const std::string& value)
+  {
+    static const char hex[] = "0123456789abcdef";
+
+    append("\"");
+    size_t run = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+      auto c = static_cast<unsigned char>(value[i]);
+      if (c >= 0x20 && c != '"' && c != '\\')
+        continue;
+
+      append(value.data() + run, i - run);
+      run = i + 1;
+      if (c == '"' || c == '\\') {
+        char escaped[2] = { '\\', static_cast<char>(c) };
+        append(escaped, sizeof(escaped));
+      }
+      else {
+        char escaped[6] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf] };
+        append(escaped, sizeof(escaped));
+      }
+    }
+    append(value.data() + run, value.size() - run);
+    append("\"");
+  }
+
+  void ChromeTraceWriter::startEvent(char phase, uint32_t pid, uint32_t tid,
+                                     double nanoseconds)
+  {
+    if (firstEvent) {
+      append("\n{\"ph\":\"");
+      firstEvent = false;
+    }
+    else
+      append(",\n{\"ph\":\"");
+    append(&phase, 1);
+    append("\",\"pid\":");
+    appendNumber(pid);
+    append(",\"tid\":");
+    appendNumber(tid);
+    append(",\"ts\":");
+    appendTimestamp(nanoseconds);
+  }
+
+  void ChromeTraceWriter::nameTrack(const char* kind, uint32_t pid,
+                                    uint32_t tid, const std::string& name)
+  {
+    startEvent('M', pid, tid, 0);
+    append(",\"name\":\"");
+    append(kind, std::strlen(kind));
+    append("\",\"args\":{\"name\":");
+    appendString(name);
+    append("}}");
+  }
+
+  const std::string& ChromeTraceWriter::lookupString(uint64_t id)
+  {
+    static const std::string unknown;
+
+    if (id >= strings.size())
+      db->getDynamicInfo().lookupStringTable(strings);
+    return id < strings.size() ? strings[id] : unknown;
+  }
+
+  uint32_t ChromeTraceWriter::addProcess(const std::string& name)
+  {
+    auto iter = processes.find(name);
+    if (iter != processes.end())
+      return iter->second;
+
+    auto pid = static_cast<uint32_t>(processes.size() + 1);
+    processes[name] = pid;
+    nameTrack("process_name", pid, 0, name);
+    return pid;
+  }
+
+  uint32_t ChromeTraceWriter::addThread(uint32_t pid, const std::string& name)
+  {
+    auto key = std::make_pair(pid, name);
+    auto iter = threads.find(key);
+    if (iter != threads.end())
+      return iter->second;
+
+    uint32_t tid = nextThread++;
+    threads[key] = tid;
+    nameTrack("thread_name", pid, tid, name);
+    return tid;
+  }
+
+  uint32_t ChromeTraceWriter::getHostProcess()
+  {
+    std::lock_guard<std::mutex> lock(writeLock);
+
+    if (hostProcess == 0)
+      hostProcess = addProcess("Host");
+    return hostProcess;
+  }
+
+  uint32_t ChromeTraceWriter::getHostThread(uint32_t threadIndex)
+  {
+    std::lock_guard<std::mutex> lock(writeLock);
+
+    if (threadIndex < hostThreads.size() && hostThreads[threadIndex] != 0)
+      return hostThreads[threadIndex];
+
+    if (hostProcess == 0)
+      hostProcess = addProcess("Host");
+    uint32_t tid = addThread(hostProcess, "Thread " + std::to_string(threadIndex));
+    if (threadIndex >= hostThreads.size())
+      hostThreads.resize(threadIndex + 1, 0);
+    hostThreads[threadIndex] = tid;
+    return tid;
+  }
+
+  uint32_t ChromeTraceWriter::getProcess(const std::string& name)
+  {
+    std::lock_guard<std::mutex> lock(writeLock);
+    return addProcess(name);
+  }
+
+  uint32_t ChromeTraceWriter::getThread(uint32_t pid, const std::string& name)
+  {
+    std::lock_guard<std::mutex> lock(writeLock);
+    return addThread(pid, name);
+  }
+
+  void ChromeTraceWriter::begin(uint32_t pid, uint32_t tid,
+                                const std::string& name, double nanoseconds)
+  {
+    std::lock_guard<std::mutex> lock(writeLock);
+
+    startEvent('B', pid, tid, nanoseconds);
+    append(",\"name\":");
+    appendString(name);
+    append("}");
+  }
+
+  void ChromeTraceWriter::begin(uint32_t pid, uint32_t tid,
+                                uint64_t name, double nanoseconds)
+  {
+    std::lock_guard<std::mutex> lock(writeLock);
+
+    startEvent('B', pid, tid, nanoseconds);
+    append(",\"name\":");
+    appendString(lookupString(name));
+    append("}");
+  }
+
+  void ChromeTraceWriter::end(uint32_t pid, uint32_t tid, double nanoseconds)
+  {
+    std::lock_guard<std::mutex> lock(writeLock);
+
+    startEvent('E', pid, tid, nanoseconds);
+    append("}");
+  }
+
+  void ChromeTraceWriter::asyncBegin(uint32_t pid, const char* category,
+                                     uint64_t name, uint64_t id,
+                                     double nanoseconds)
+  {
+    std::lock_guard<std::mutex> lock(writeLock);
+
+    startEvent('b', pid, 0, nanoseconds);
+    append(",\"cat\":");
+    appendString(category);
+    append(",\"id\":");
+    appendNumber(id);
+    append(",\"name\":");
+    appendString(lookupString(name));
+    append("}");
+  }
+
+  void ChromeTraceWriter::asyncEnd(uint32_t pid, const char* category,
+                                   uint64_t name, uint64_t id,
+                                   double nanoseconds)
+  {
+    std::lock_guard<std::mutex> lock(writeLock);
+
+    startEvent('e', pid, 0, nanoseconds);
+    append(",\"cat\":");
+    appendString(category);
+    append(",\"id\":");
+    appendNumber(id);
+    append(",\"name\":");
+    appendString(lookupString(name));
+    append("}");
+  }
+
+  bool ChromeTraceWriter::write(bool /*openNewFile*/)
+  {
+    std::lock_guard<std::mutex> lock(writeLock);
+
+    // All events go to the one file for the whole run
+    flushBuffer();
+    fout.flush();
+    return true;
+  }
+
+} // end namespace xdp
@@ -0,0 +1,116 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef CHROME_TRACE_WRITER_DOT_H
+#define CHROME_TRACE_WRITER_DOT_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "xdp/config.h"
+#include "xdp/profile/writer/vp_base/vp_writer.h"
+
+namespace xdp {
+
+  // Writer of trace events in the Chrome JSON trace event format, which
+  // Perfetto and chrome://tracing load directly.  Instead of collecting
+  // events from the database itself, it is fed by the trace writers of
+  // the plugins as they write their own files, so every event is still
+  // only read out of the database once.  All host and device events
+  // end up in one file, on one track per host thread, compute unit or
+  // monitor.
+  //
+  // Events are formatted into a buffer that is written out whenever it
+  // fills up and after each trace writer is done.  The closing bracket
+  // of the event array is optional in this format, so the file can be
+  // loaded at any point during the run.
+  class ChromeTraceWriter : public VPWriter
+  {
+  private:
+    static constexpr size_t bufferSize = 1 << 20;
+
+    std::vector<char> buffer;
+    size_t used = 0;
+    bool firstEvent = true;
+
+    // Track ids, each with metadata naming it written on first use
+    uint32_t hostProcess = 0;
+    std::vector<uint32_t> hostThreads;  // By host thread index
+    std::map<std::string, uint32_t> processes;
+    std::map<std::pair<uint32_t, std::string>, uint32_t> threads;
+    uint32_t nextThread = 1;
+
+    // The database string table by id
+    std::vector<std::string> strings;
+
+    // Plugins may write at the same time during continuous offload
+    std::mutex writeLock;
+
+    void flushBuffer();
+    void append(const char* data, size_t size);
+    template <size_t N>
+    void append(const char (&literal)[N]) { append(literal, N - 1); }
+    void appendNumber(uint64_t value);
+    void appendTimestamp(double nanoseconds);
+    void appendString(const std::string& value);
+    void startEvent(char phase, uint32_t pid, uint32_t tid, double nanoseconds);
+
+    void nameTrack(const char* kind, uint32_t pid, uint32_t tid,
+                   const std::string& name);
+    const std::string& lookupString(uint64_t id);
+    uint32_t addProcess(const std::string& name);
+    uint32_t addThread(uint32_t pid, const std::string& name);
+
+  public:
+    XDP_CORE_EXPORT ChromeTraceWriter(const char* filename, VPDatabase* inst);
+    XDP_CORE_EXPORT ~ChromeTraceWriter();
+
+    // Track ids.  Host threads are tracks of the host process, device
+    // tracks are named threads of a process per device.
+    XDP_CORE_EXPORT uint32_t getHostProcess();
+    XDP_CORE_EXPORT uint32_t getHostThread(uint32_t threadIndex);
+    XDP_CORE_EXPORT uint32_t getProcess(const std::string& name);
+    XDP_CORE_EXPORT uint32_t getThread(uint32_t pid, const std::string& name);
+
+    // Duration events that nest on a track.  Timestamps are in
+    // nanoseconds.  Names are given either directly or by their id in
+    // the database string table.
+    XDP_CORE_EXPORT void begin(uint32_t pid, uint32_t tid,
+                               const std::string& name, double nanoseconds);
+    XDP_CORE_EXPORT void begin(uint32_t pid, uint32_t tid,
+                               uint64_t name, double nanoseconds);
+    XDP_CORE_EXPORT void end(uint32_t pid, uint32_t tid, double nanoseconds);
+
+    // Events that can overlap, so the begin and end of each are matched
+    // by their id within the category instead of by nesting
+    XDP_CORE_EXPORT void asyncBegin(uint32_t pid, const char* category,
+                                    uint64_t name, uint64_t id,
+                                    double nanoseconds);
+    XDP_CORE_EXPORT void asyncEnd(uint32_t pid, const char* category,
+                                  uint64_t name, uint64_t id,
+                                  double nanoseconds);
+
+    // Write out the buffered events
+    XDP_CORE_EXPORT virtual bool write(bool openNewFile);
+  };
+
+} // end namespace xdp
+
+#endif
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -538,6 +538,22 @@ namespace {
     }
   }
 
+  // Reported only for devices whose trace buffer overflowed
+  static void traceBufferOverflow(xdp::VPDatabase* db, std::ofstream& fout)
+  {
+    auto deviceInfos = db->getStaticInfo().getDeviceInfos() ;
+    for (auto device : deviceInfos) {
+      auto overflows = db->getDynamicInfo().getPLTraceOverflows(device->deviceId);
+      if (!overflows)
+        continue;
+      fout << "TRACE_BUFFER_OVERFLOW,"
+           << device->getUniqueDeviceName() << ","
+           << overflows << ","
+           << db->getDynamicInfo().getPLTraceDroppedPackets(device->deviceId)
+           << ",\n" ;
+    }
+  }
+
   static void memoryTypeBitWidth(xdp::VPDatabase* db, std::ofstream& fout)
   {
     if (xdp::getFlowMode() == xdp::SW_EMU) {
@@ -728,6 +744,7 @@ namespace xdp {
     rules.push_back(traceMemory) ;
     rules.push_back(PLRAMSizeBytes) ;
     rules.push_back(traceBufferFull) ;
+    rules.push_back(traceBufferOverflow) ;
     rules.push_back(memoryTypeBitWidth) ;
     rules.push_back(applicationRunTimeMs) ;
 
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -49,6 +49,11 @@ namespace xdp {
     addParameter("trace_buffer_size",
                  xrt_core::config::get_trace_buffer_size(),
                  "Size of buffer to allocate for trace (memory offload only)");
+    addParameter("trace_memory_limit",
+                 xrt_core::config::get_trace_memory_limit(),
+                 "Memory for trace events above which they are spilled to disk (0 to disable)");
+    addParameter("chrome_trace", xrt_core::config::get_chrome_trace(),
+                 "Generation of all trace in Chrome JSON format for Perfetto");
     addParameter("verbosity", xrt_core::config::get_verbosity(),
                  "Verbosity level");
     addParameter("continuous_trace", xrt_core::config::get_continuous_trace(),
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -187,6 +187,22 @@ namespace xdp {
     fout << "\n" ;
   }
 
+  bool
+  SummaryWriter::isAPIType(const std::string& APIName, APIType type)
+  {
+    switch (type) {
+    case OPENCL:
+      return OpenCLAPIs.find(APIName) != OpenCLAPIs.end() ;
+    case NATIVE:
+      return NativeAPIs.find(APIName) != NativeAPIs.end() ;
+    case HAL:
+      return HALAPIs.find(APIName) != HALAPIs.end() ;
+    case ALL: // Intentionally fall through
+    default:
+      return true ;
+    }
+  }
+
   void
   SummaryWriter::writeAPICalls(APIType type)
   {
@@ -206,20 +222,7 @@ namespace xdp {
       auto callAndThread = call.first ;
       auto APIName = callAndThread.first ;
 
-      switch (type) {
-      case OPENCL:
-        if (OpenCLAPIs.find(APIName) == OpenCLAPIs.end()) continue ;
-        break ;
-      case NATIVE:
-        if (NativeAPIs.find(APIName) == NativeAPIs.end()) continue ;
-        break ;
-      case HAL:
-        if (HALAPIs.find(APIName) == HALAPIs.end()) continue ;
-        break ;
-      case ALL: // Intentionally fall through
-      default:
-        break ;
-      }
+      if (!isAPIType(APIName, type)) continue ;
 
       std::vector<std::pair<double, double>> timesOfCalls = call.second ;
 
@@ -242,6 +245,26 @@ namespace xdp {
       }
     }
 
+    // Native API calls are aggregated as they complete
+    for (const auto& call : (db->getStats()).getCallSummaries()) {
+      auto APIName = call.first ;
+      if (!isAPIType(APIName, type)) continue ;
+
+      if (rows.find(APIName) == rows.end()) {
+        std::tuple<uint64_t, double, double, double> blank =
+          std::make_tuple<uint64_t, double, double, double>(0,0,std::numeric_limits<double>::max(),0) ;
+
+        rows[APIName] = blank ;
+      }
+
+      std::get<0>(rows[APIName]) += call.second.count ;
+      std::get<1>(rows[APIName]) += call.second.totalTime ;
+      if (call.second.minTime < std::get<2>(rows[APIName]))
+        std::get<2>(rows[APIName]) = call.second.minTime ;
+      if (call.second.maxTime > std::get<3>(rows[APIName]))
+        std::get<3>(rows[APIName]) = call.second.maxTime ;
+    }
+
     for (const auto& row : rows) {
       auto averageTime =
         static_cast<double>(std::get<1>(row.second)) / static_cast<double>(std::get<0>(row.second)) ;
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -54,6 +54,7 @@ namespace xdp {
 
     // Generic host tables
     enum APIType { OPENCL, NATIVE, HAL, ALL } ;
+    bool isAPIType(const std::string& APIName, APIType type) ;
     void writeAPICalls(APIType type) ;
 
     // OpenCL specific device tables
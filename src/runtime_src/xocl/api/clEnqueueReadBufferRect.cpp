@@ -1,5 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -26,6 +27,7 @@
 #include "detail/memory.h"
 #include "detail/event.h"
 #include "plugin/xdp/profile_v2.h"
+#include "core/common/strided_copy.h"
 
 namespace xocl {
 
@@ -39,32 +41,6 @@ origin_in_bytes(const size_t* origin,
        + origin[0];
 }
 
-static void
-setIfZero(size_t& src_row_pitch,
-          size_t& src_slice_pitch,
-          size_t& dst_row_pitch,
-          size_t& dst_slice_pitch,
-          const size_t* region)
-{
-  // If src_row_pitch is 0, src_row_pitch is computed as region[0].
-  if (!src_row_pitch)
-    src_row_pitch = region[0];
-
-  // If src_slice_pitch is 0, src_slice_pitch is computed as region[1]
-  // * src_row_pitch.
-  if (!src_slice_pitch)
-    src_slice_pitch = region[1]*src_row_pitch;
-
-  // If dst_row_pitch is 0, dst_row_pitch is computed as region[0].
-  if (!dst_row_pitch)
-    dst_row_pitch = region[0];
-
-  // If dst_slice_pitch is 0, dst_slice_pitch is computed as region[1]
-  // * dst_row_pitch.
-  if (!dst_slice_pitch)
-    dst_slice_pitch = region[1]*dst_row_pitch;
-}
-
 static void
 validOrError(cl_command_queue     command_queue ,
              cl_mem               buffer ,
@@ -116,17 +92,14 @@ clEnqueueReadBufferRect(cl_command_queue     command_queue ,
                          const cl_event *     event_wait_list ,
                          cl_event *           event )
 {
-  setIfZero(buffer_row_pitch,buffer_slice_pitch,host_row_pitch,host_slice_pitch,region);
+  xrt_core::set_default_rect_pitches(buffer_row_pitch,buffer_slice_pitch,region);
+  xrt_core::set_default_rect_pitches(host_row_pitch,host_slice_pitch,region);
 
   validOrError(command_queue,buffer,blocking
                ,buffer_origin,host_origin,region
                ,buffer_row_pitch,buffer_slice_pitch,host_row_pitch,host_slice_pitch
                ,ptr,num_events_in_wait_list ,event_wait_list,event);
 
-  size_t buffer_origin_in_bytes = origin_in_bytes(buffer_origin,
-                                                  buffer_row_pitch,
-                                                  buffer_slice_pitch);
-
   size_t host_origin_in_bytes = origin_in_bytes(host_origin,host_row_pitch,
                                                 host_slice_pitch);
 
@@ -145,31 +118,22 @@ clEnqueueReadBufferRect(cl_command_queue     command_queue ,
     xocl::xocl(*event)->queue(true /*wait*/);
   }
 
-  auto device = xocl::xocl(command_queue)->get_device();
-  auto boh = xocl::xocl(buffer)->get_buffer_object_or_error(device);
-  cl_int errc = 0;
-
-  // This is memory map is bigger than we could make it when start offsets is not 0, 0, 0.
-  void *host_ptr = clEnqueueMapBuffer(command_queue, buffer, true, CL_MAP_READ,
-                                      0, boh.size(), num_events_in_wait_list,
-                                      event_wait_list, nullptr, &errc);
-  if (errc)
-    return errc;
-
-  size_t yit, zit;
-  for (zit = 0; zit < region[2]; zit++) {
-    for (yit = 0; yit < region[1]; yit++) {
-      size_t buffer_row_origin_in_bytes = buffer_origin_in_bytes +
-                                          zit * buffer_slice_pitch +
-                                          yit * buffer_row_pitch;
-      size_t host_row_origin_in_bytes =
-          host_origin_in_bytes + zit * host_slice_pitch + yit * host_row_pitch;
-      memcpy(&((uint8_t *)(ptr))[host_row_origin_in_bytes],
-             &((uint8_t *)(host_ptr))[buffer_row_origin_in_bytes], region[0]);
-    }
+  // Map and sync only the bytes covered by the buffer rectangle
+  auto range = xrt_core::rect_byte_range(buffer_origin, region, buffer_row_pitch, buffer_slice_pitch);
+  if (range.size) {
+    cl_int errc = 0;
+    void *host_ptr = clEnqueueMapBuffer(command_queue, buffer, true, CL_MAP_READ,
+                                        range.offset, range.size, num_events_in_wait_list,
+                                        event_wait_list, nullptr, &errc);
+    if (errc)
+      return errc;
+
+    xrt_core::copy_rect(static_cast<uint8_t*>(ptr) + host_origin_in_bytes, host_row_pitch, host_slice_pitch,
+                        host_ptr, buffer_row_pitch, buffer_slice_pitch, region);
+
+    clEnqueueUnmapMemObject(command_queue, buffer, host_ptr, 0, nullptr, nullptr);
   }
 
-  clEnqueueUnmapMemObject(command_queue, buffer, host_ptr, 0, nullptr, nullptr);
   if (event)
     xocl::xocl(*event)->set_status(CL_COMPLETE);
 
@@ -1,5 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -28,6 +29,7 @@
 #include "detail/event.h"
 #include "detail/context.h"
 #include "plugin/xdp/profile_v2.h"
+#include "core/common/strided_copy.h"
 
 namespace xocl {
 
@@ -82,15 +84,14 @@ clEnqueueWriteBufferRect(cl_command_queue     command_queue ,
                          const cl_event *     event_wait_list ,
                          cl_event *           event )
 {
+  xrt_core::set_default_rect_pitches(host_row_pitch,host_slice_pitch,region);
+  xrt_core::set_default_rect_pitches(buffer_row_pitch,buffer_slice_pitch,region);
+
   validOrError(command_queue,buffer,blocking
                ,buffer_origin,host_origin,region
                ,buffer_row_pitch,buffer_slice_pitch,host_row_pitch,host_slice_pitch
                ,ptr,num_events_in_wait_list ,event_wait_list,event);
 
-  size_t buffer_origin_in_bytes = 
-    buffer_origin[2]*buffer_slice_pitch+
-    buffer_origin[1]*buffer_row_pitch+
-    buffer_origin[0];
   size_t host_origin_in_bytes = 
     host_origin[2]*host_slice_pitch+
     host_origin[1]*host_row_pitch+
@@ -114,26 +115,28 @@ clEnqueueWriteBufferRect(cl_command_queue     command_queue ,
   // Now the event is running, this should be hard_event and handle asynchronously
   auto device = xocl::xocl(command_queue)->get_device();
   auto xdevice = device->get_xdevice();
-  auto boh = xocl::xocl(buffer)->get_buffer_object_or_error(device);
-  void* host_ptr = xdevice->map(boh);
-  
-  size_t yit,zit;
-  for(zit=0;zit<region[2];zit++){
-    for(yit=0;yit<region[1];yit++){
-      size_t buffer_row_origin_in_bytes =
-        buffer_origin_in_bytes+
-        zit*buffer_slice_pitch+
-        yit*buffer_row_pitch;
-      size_t host_row_origin_in_bytes =
-        host_origin_in_bytes+
-        zit*host_slice_pitch+
-        yit*host_row_pitch;
-      memcpy( &((uint8_t *)(host_ptr))[buffer_row_origin_in_bytes],
-              &((uint8_t *)(ptr))[host_row_origin_in_bytes],
-              region[0]);
-    }
+  auto mem = xocl::xocl(buffer);
+  auto boh = mem->get_buffer_object_or_error(device);
+
+  // Sync only the bytes covered by the buffer rectangle.  Bytes between
+  // rows of a resident buffer are refreshed from device before the rows
+  // are written, so the range can be synced back as a whole.
+  auto range = xrt_core::rect_byte_range(buffer_origin, region, buffer_row_pitch, buffer_slice_pitch);
+  if (range.size) {
+    using direction = xrt_xocl::hal::device::direction;
+    bool resident = mem->is_resident(device) && !mem->no_host_memory();
+    if (resident && range.size != region[0] * region[1] * region[2])
+      xdevice->sync(boh, range.size, range.offset, direction::DEVICE2HOST, false);
+
+    auto host_ptr = static_cast<uint8_t*>(xdevice->map(boh));
+    xrt_core::copy_rect(host_ptr + range.offset, buffer_row_pitch, buffer_slice_pitch,
+                        static_cast<const uint8_t*>(ptr) + host_origin_in_bytes, host_row_pitch, host_slice_pitch,
+                        region);
+    xdevice->unmap(boh);
+
+    if (resident)
+      xdevice->sync(boh, range.size, range.offset, direction::HOST2DEVICE, false);
   }
-  xdevice->unmap(boh);
 
   if (event)
     xocl::xocl(*event)->set_status(CL_COMPLETE);
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc.
+
+// Measure hipMemcpyAsync throughput on a single stream for copy sizes
+// from 4 KB to 256 MB in both directions.  Each size is copied
+// repeatedly and the stream is synchronized once per size such that
+// the measurement includes the asynchronous copy pipeline.
+//
+// % memcpy-async [max size in MB (default 256)]
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "hip/hip_runtime_api.h"
+
+#include "common.h"
+
+namespace {
+
+constexpr size_t min_size = 4 * 1024;
+constexpr size_t total_bytes_per_size = 1024 * xrt_hip_test_common::mega_byte;
+constexpr int min_loops = 4;
+constexpr int max_loops = 10000;
+
+int
+loops_for(size_t size)
+{
+  auto loops = static_cast<int>(total_bytes_per_size / size);
+  return std::max(min_loops, std::min(max_loops, loops));
+}
+
+void
+measure(const char* direction, void* dst, const void* src, size_t size, hipMemcpyKind kind, hipStream_t stream)
+{
+  auto loops = loops_for(size);
+  xrt_hip_test_common::hip_test_timer timer;
+  for (int i = 0; i < loops; ++i)
+    xrt_hip_test_common::test_hip_check(hipMemcpyAsync(dst, src, size, kind, stream), "hipMemcpyAsync");
+  xrt_hip_test_common::test_hip_check(hipStreamSynchronize(stream), "hipStreamSynchronize");
+  auto usec = timer.stop();
+
+  auto mbps = (static_cast<double>(size) * loops / xrt_hip_test_common::mega_byte)
+    / (static_cast<double>(usec) / xrt_hip_test_common::hip_test_timer::unit());
+  std::cout << std::setw(6) << direction
+            << std::setw(12) << size
+            << std::setw(8) << loops
+            << std::setw(12) << usec / loops << " us/copy"
+            << std::setw(12) << std::fixed << std::setprecision(1) << mbps << " MB/s\n";
+}
+
+void
+run(size_t max_size)
+{
+  xrt_hip_test_common::hip_test_device device;
+  device.show_info(std::cout);
+
+  hipStream_t stream = nullptr;
+  xrt_hip_test_common::test_hip_check(hipStreamCreate(&stream), "hipStreamCreate");
+
+  xrt_hip_test_common::hip_test_device_bo<unsigned char> dbuf(max_size);
+  std::vector<unsigned char> hbuf(max_size, 0xa5);
+
+  std::cout << std::setw(6) << "dir" << std::setw(12) << "bytes" << std::setw(8) << "loops\n";
+  for (size_t size = min_size; size <= max_size; size *= 4)
+    measure("H2D", dbuf.get(), hbuf.data(), size, hipMemcpyHostToDevice, stream);
+
+  for (size_t size = min_size; size <= max_size; size *= 4)
+    measure("D2H", hbuf.data(), dbuf.get(), size, hipMemcpyDeviceToHost, stream);
+
+  xrt_hip_test_common::test_hip_check(hipStreamDestroy(stream), "hipStreamDestroy");
+}
+
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+  try {
+    size_t max_mb = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 256;
+    run(max_mb * xrt_hip_test_common::mega_byte);
+    return 0;
+  }
+  catch (const std::exception& ex) {
+    std::cerr << "Error: " << ex.what() << '\n';
+  }
+  return 1;
+}
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc.
+
+// Verify that blocks kept in the per-thread caches of the default
+// memory pool do not make allocations fail while the pool has room.
+//
+// A small block is allocated and freed first, which parks it in a
+// cache and keeps the first node of the pool busy.  The pool is then
+// filled with allocations of a whole node each until an allocation
+// fails.  The last node to be filled is the first one, which is only
+// free once the cached block is returned to it, so all of the memory
+// reserved by the pool must end up in use.
+//
+// The default pool reserves up to 4GB of device memory.
+//
+// % mempool-cache
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "hip/hip_runtime_api.h"
+
+#include "common.h"
+
+namespace {
+
+constexpr size_t small_size = 4096;
+constexpr int max_blocks = 64;
+
+uint64_t
+get_attribute(hipMemPool_t pool, hipMemPoolAttr attr)
+{
+  uint64_t value = 0;
+  xrt_hip_test_common::test_hip_check(hipMemPoolGetAttribute(pool, attr, &value), "hipMemPoolGetAttribute");
+  return value;
+}
+
+void
+run()
+{
+  xrt_hip_test_common::hip_test_device device;
+  device.show_info(std::cout);
+
+  hipStream_t stream = nullptr;
+  xrt_hip_test_common::test_hip_check(hipStreamCreate(&stream), "hipStreamCreate");
+
+  hipMemPool_t pool = nullptr;
+  xrt_hip_test_common::test_hip_check(hipDeviceGetDefaultMemPool(&pool, 0), "hipDeviceGetDefaultMemPool");
+
+  // Keep the reserved memory on stream synchronization, trimming the
+  // pool would also flush the caches
+  uint64_t threshold = std::numeric_limits<uint64_t>::max();
+  xrt_hip_test_common::test_hip_check(hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &threshold),
+                                      "hipMemPoolSetAttribute");
+
+  // One node is reserved up front, every node has the same size
+  auto block_size = get_attribute(pool, hipMemPoolAttrReservedMemCurrent);
+  auto used_before = get_attribute(pool, hipMemPoolAttrUsedMemCurrent);
+  if (used_before)
+    throw std::runtime_error("default memory pool is already in use");
+
+  void* small = nullptr;
+  xrt_hip_test_common::test_hip_check(hipMallocAsync(&small, small_size, stream), "hipMallocAsync");
+  xrt_hip_test_common::test_hip_check(hipFreeAsync(small, stream), "hipFreeAsync");
+  xrt_hip_test_common::test_hip_check(hipStreamSynchronize(stream), "hipStreamSynchronize");
+
+  // A failed allocation leaves the used memory unchanged
+  std::vector<void*> blocks;
+  for (int i = 0; i < max_blocks; ++i) {
+    void* ptr = nullptr;
+    xrt_hip_test_common::test_hip_check(hipMallocAsync(&ptr, block_size, stream), "hipMallocAsync");
+    xrt_hip_test_common::test_hip_check(hipStreamSynchronize(stream), "hipStreamSynchronize");
+    if (get_attribute(pool, hipMemPoolAttrUsedMemCurrent) != block_size * (blocks.size() + 1))
+      break;
+    blocks.push_back(ptr);
+  }
+
+  auto reserved = get_attribute(pool, hipMemPoolAttrReservedMemCurrent);
+  auto used = get_attribute(pool, hipMemPoolAttrUsedMemCurrent);
+  std::cout << "blocks: " << blocks.size() << " of " << block_size << " bytes, "
+            << "reserved: " << reserved << " bytes, used: " << used << " bytes\n";
+
+  for (auto ptr : blocks)
+    xrt_hip_test_common::test_hip_check(hipFreeAsync(ptr, stream), "hipFreeAsync");
+  xrt_hip_test_common::test_hip_check(hipStreamSynchronize(stream), "hipStreamSynchronize");
+  xrt_hip_test_common::test_hip_check(hipStreamDestroy(stream), "hipStreamDestroy");
+
+  if (blocks.empty() || used != reserved)
+    throw std::runtime_error("allocation failed while the memory pool had a free node");
+}
+
+} // namespace
+
+int
+main()
+{
+  try {
+    run();
+    std::cout << "TEST PASSED\n";
+    return 0;
+  }
+  catch (const std::exception& ex) {
+    std::cerr << "Error: " << ex.what() << '\n';
+  }
+  std::cout << "TEST FAILED\n";
+  return 1;
+}
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2021-2022 Xilinx, Inc. All rights reserved.
-// Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2025-2026 Advanced Micro Devices, Inc. All rights reserved.
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -156,6 +157,18 @@ list_xclbins_in_repo()
     auto xclbin = (*itr);
     std::cout << "xsa(" << xclbin.get_xsa_name() << ")\n";
     std::cout << "uuid(" << xclbin.get_uuid().to_string() << ")\n";
+
+    // Indexed lookups must agree with iteration
+    if (repo.load_by_uuid(xclbin.get_uuid()).get_uuid() != xclbin.get_uuid())
+      throw std::runtime_error("load_by_uuid returned wrong xclbin");
+
+    for (const auto& kernel : xclbin.get_kernels()) {
+      if (kernel.get_cus().empty())
+        continue;  // only compute units are indexed
+      auto paths = repo.find_by_kernel(kernel.get_name());
+      if (std::find(paths.begin(), paths.end(), itr.path()) == paths.end())
+        throw std::runtime_error("find_by_kernel did not find " + kernel.get_name());
+    }
   }
 }
 
@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "xrt/xrt_bo.h"
+#include "xrt/xrt_device.h"
+#include "xrt/xrt_hw_context.h"
+#include "xrt/xrt_kernel.h"
+
+// Verify that re-submitting a run object is free of heap allocations
+// once the run has been started and waited on.
+//
+// The test re-starts the same run object with one global argument
+// alternating between two buffers while the remaining arguments are
+// re-set to the same values, which is the typical inference loop.
+// Global operator new is replaced to count allocations made by the
+// process while the steady state iterations execute.
+//
+// The test is intended to run on the noop shim which completes
+// commands synchronously upon submission.  Any PL xclbin can be used
+// with the noop shim, the kernel is not executed.
+//
+// % g++ -g -std=c++17 -I$XILINX_XRT/include -L$XILINX_XRT/lib -o run_noalloc.exe main.cpp -lxrt_coreutil -luuid -pthread
+// % XCL_EMULATION_MODE=noop run_noalloc.exe -k <xclbin> --kernel <name>
+
+#ifdef _WIN32
+# pragma warning( disable : 4996 )
+#endif
+
+static std::atomic<bool> count_allocations {false};
+static std::atomic<size_t> allocations {0};
+
+void*
+operator new(std::size_t sz)
+{
+  if (count_allocations)
+    ++allocations;
+  if (auto ptr = std::malloc(sz ? sz : 1))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void*
+operator new[](std::size_t sz)
+{
+  return operator new(sz);
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete[](void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+static void
+usage()
+{
+  std::cout << "usage: %s [options]\n\n"
+            << "  -k <bitstream>\n"
+            << "  --kernel <name>\n"
+            << "  [-d <bdf | device_index>]\n"
+            << "  [-n <iterations>]: steady state iterations (default 10000)\n"
+            << "  -h\n\n";
+}
+
+static int
+run(int argc, char** argv)
+{
+  if (argc < 3) {
+    usage();
+    return 1;
+  }
+
+  std::string xclbin_fnm;
+  std::string kernel_name;
+  std::string device_index = "0";
+  size_t iterations = 10000;
+
+  std::vector<std::string> args(argv+1,argv+argc);
+  std::string cur;
+  for (auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return 1;
+    }
+
+    if (arg[0] == '-') {
+      cur = arg;
+      continue;
+    }
+
+    if (cur == "-k")
+      xclbin_fnm = arg;
+    else if (cur == "--kernel")
+      kernel_name = arg;
+    else if (cur == "-d")
+      device_index = arg;
+    else if (cur == "-n")
+      iterations = std::stoul(arg);
+    else
+      throw std::runtime_error("Unknown option value " + cur + " " + arg);
+  }
+
+  if (xclbin_fnm.empty() || kernel_name.empty())
+    throw std::runtime_error("No xclbin or kernel specified");
+
+  xrt::device device{device_index};
+  xrt::xclbin xclbin{xclbin_fnm};
+  auto uuid = device.register_xclbin(xclbin);
+  xrt::hw_context hwctx{device, uuid};
+  xrt::kernel kernel{hwctx, kernel_name};
+  xrt::run run{kernel};
+
+  // Populate argument values, the first global argument alternates
+  // between two buffers
+  struct arg_value
+  {
+    int index;
+    xrt::bo bo[2];
+    std::vector<char> scalar;
+  };
+  std::vector<arg_value> values;
+  int alternate = -1;
+  for (const auto& arg : xclbin.get_kernel(kernel_name).get_args()) {
+    auto& value = values.emplace_back();
+    value.index = static_cast<int>(arg.get_index());
+    auto type = arg.get_host_type();
+    if (!type.empty() && type.back() == '*') {
+      auto grp = kernel.group_id(value.index);
+      value.bo[0] = xrt::bo(device, 4096, grp);
+      value.bo[1] = (alternate < 0) ? xrt::bo(device, 4096, grp) : value.bo[0];
+      if (alternate < 0)
+        alternate = value.index;
+    }
+    else {
+      value.scalar.resize(arg.get_size());
+    }
+  }
+
+  auto iteration = [&run, &values](size_t i) {
+    for (const auto& value : values) {
+      if (value.bo[0])
+        run.set_arg(value.index, value.bo[i % 2]);
+      else if (!value.scalar.empty())
+        run.set_arg(value.index, static_cast<const void*>(value.scalar.data()), value.scalar.size());
+    }
+    run.start();
+    run.wait();
+  };
+
+  // Warm up, first iterations may allocate
+  for (size_t i = 0; i < 2; ++i)
+    iteration(i);
+
+  count_allocations = true;
+  for (size_t i = 0; i < iterations; ++i)
+    iteration(i);
+  count_allocations = false;
+
+  std::cout << "iterations(" << iterations << ") allocations(" << allocations << ")\n";
+  if (allocations)
+    throw std::runtime_error("steady state run re-submission allocated memory");
+
+  return 0;
+}
+
+int
+main(int argc, char** argv)
+{
+  try {
+    auto ret = run(argc, argv);
+    std::cout << "PASSED TEST\n";
+    return ret;
+  }
+  catch (std::exception const& e) {
+    std::cout << "Exception: " << e.what() << "\n";
+    std::cout << "FAILED TEST\n";
+    return 1;
+  }
+}